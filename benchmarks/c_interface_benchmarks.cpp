@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "umpire/ResourceManager.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+#include "umpire/interface/c_fortran/umpire.h"
+
+//
+// Compares allocating through the Shroud generated C wrappers with the
+// cached handles of handleUmpire.h, from a pool so that the cost of the
+// interface is not hidden behind the cost of the resource.
+//
+
+static const char* Pool_Name{"c_interface_pool"};
+static const std::size_t Bytes{64};
+static const int Bulk_Count{64};
+
+static void make_pool()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  if (!rm.isAllocator(Pool_Name)) {
+    rm.makeAllocator<umpire::strategy::QuickPool>(Pool_Name, rm.getAllocator("HOST"));
+  }
+}
+
+// What a caller without a place to keep the Allocator does for each allocation
+static void ShroudLookup(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_resourcemanager rm;
+  umpire_resourcemanager_get_instance(&rm);
+
+  while (st.KeepRunning()) {
+    umpire_allocator allocator;
+    umpire_resourcemanager_get_allocator_by_name(&rm, Pool_Name, &allocator);
+    void* ptr = umpire_allocator_allocate(&allocator, Bytes);
+    umpire_allocator_deallocate(&allocator, ptr);
+    umpire_allocator_delete(&allocator);
+  }
+}
+
+static void ShroudCached(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_resourcemanager rm;
+  umpire_resourcemanager_get_instance(&rm);
+  umpire_allocator allocator;
+  umpire_resourcemanager_get_allocator_by_name(&rm, Pool_Name, &allocator);
+
+  while (st.KeepRunning()) {
+    void* ptr = umpire_allocator_allocate(&allocator, Bytes);
+    benchmark::DoNotOptimize(ptr);
+    umpire_allocator_deallocate(&allocator, ptr);
+  }
+
+  umpire_allocator_delete(&allocator);
+}
+
+static void Handle(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_handle handle = umpire_handle_get_by_name(Pool_Name);
+
+  while (st.KeepRunning()) {
+    void* ptr = umpire_handle_allocate(handle, Bytes);
+    benchmark::DoNotOptimize(ptr);
+    umpire_handle_deallocate(handle, ptr);
+  }
+}
+
+static void HandleSized(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_handle handle = umpire_handle_get_by_name(Pool_Name);
+
+  while (st.KeepRunning()) {
+    void* ptr = umpire_handle_allocate(handle, Bytes);
+    benchmark::DoNotOptimize(ptr);
+    umpire_handle_deallocate_sized(handle, ptr, Bytes);
+  }
+}
+
+static void ShroudLoop(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_resourcemanager rm;
+  umpire_resourcemanager_get_instance(&rm);
+  umpire_allocator allocator;
+  umpire_resourcemanager_get_allocator_by_name(&rm, Pool_Name, &allocator);
+  std::vector<void*> ptrs(Bulk_Count);
+
+  while (st.KeepRunning()) {
+    for (int i = 0; i < Bulk_Count; ++i) {
+      ptrs[i] = umpire_allocator_allocate(&allocator, Bytes);
+    }
+    for (int i = 0; i < Bulk_Count; ++i) {
+      umpire_allocator_deallocate(&allocator, ptrs[i]);
+    }
+  }
+
+  umpire_allocator_delete(&allocator);
+  st.SetItemsProcessed(st.iterations() * Bulk_Count);
+}
+
+static void HandleBulk(benchmark::State& st)
+{
+  make_pool();
+
+  umpire_handle handle = umpire_handle_get_by_name(Pool_Name);
+  std::vector<void*> ptrs(Bulk_Count);
+
+  while (st.KeepRunning()) {
+    umpire_handle_allocate_bulk(handle, Bulk_Count, Bytes, ptrs.data());
+    umpire_handle_deallocate_bulk(handle, ptrs.data(), Bulk_Count);
+  }
+
+  st.SetItemsProcessed(st.iterations() * Bulk_Count);
+}
+
+BENCHMARK(ShroudLookup);
+BENCHMARK(ShroudCached);
+BENCHMARK(Handle);
+BENCHMARK(HandleSized);
+BENCHMARK(ShroudLoop);
+BENCHMARK(HandleBulk);
+
+BENCHMARK_MAIN();
@@ -55,6 +55,11 @@ if (NOT "${CMAKE_CXX_COMPILER_ID}" STREQUAL "MSVC")
     )
 endif ()
 
+find_package(Threads REQUIRED)
+blt_register_library( NAME umpire_threads
+  LIBRARIES ${CMAKE_THREAD_LIBS_INIT}
+  )
+
 set(TPL_DEPS)
 blt_list_append(TO TPL_DEPS ELEMENTS cuda cuda_runtime IF ENABLE_CUDA)
 blt_list_append(TO TPL_DEPS ELEMENTS hip hip_runtime IF ENABLE_HIP)
@@ -41,6 +41,7 @@ class GenericReallocateOperation;
  * \see TypedAllocator
  */
 class Allocator : private strategy::mixins::Inspector, strategy::mixins::AllocateNull {
+  friend class AllocatorHandle;
   friend class ResourceManager;
   friend class ::AllocatorTest;
   friend class umpire::op::HostReallocateOperation;
@@ -78,6 +79,45 @@ class Allocator : private strategy::mixins::Inspector, strategy::mixins::Allocat
    */
   inline void deallocate(void* ptr);
 
+  /*!
+   * \brief Free the memory at ptr, which was allocated with size bytes.
+   *
+   * The size is trusted rather than looked up, so the allocation's record is
+   * not consulted before the memory is returned to the AllocationStrategy.
+   * Debug builds check the size against the record, and throw an
+   * umpire::Exception if they differ.
+   *
+   * \param ptr Pointer to free (If nullptr, it will be ignored.)
+   * \param size Number of bytes ptr was allocated with.
+   */
+  inline void deallocate(void* ptr, std::size_t size);
+
+  /*!
+   * \brief Allocate count blocks of bytes each.
+   *
+   * This is equivalent to calling allocate count times, but the
+   * AllocationStrategy may carve all the blocks out of one allocation, and
+   * the blocks are tracked at once. Each block is deallocated on its own or
+   * with deallocate_bulk.
+   *
+   * \param count Number of blocks to allocate.
+   * \param bytes Number of bytes in each block (>= 0).
+   * \param ptrs Array of count pointers set to the start of each block.
+   */
+  inline void allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs);
+
+  /*!
+   * \brief Free count blocks of memory at once.
+   *
+   * This method will throw an umpire::Exception, without freeing any of the
+   * blocks, if one of them was not allocated using this Allocator. Null
+   * pointers are ignored.
+   *
+   * \param ptrs Array of count pointers to free.
+   * \param count Number of pointers in ptrs.
+   */
+  inline void deallocate_bulk(void* const* ptrs, std::size_t count);
+
   /*!
    * \brief Release any and all unused memory held by this Allocator.
    */
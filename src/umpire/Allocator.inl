@@ -7,6 +7,8 @@
 #ifndef UMPIRE_Allocator_INL
 #define UMPIRE_Allocator_INL
 
+#include <vector>
+
 #include "umpire/Allocator.hpp"
 #include "umpire/Replay.hpp"
 #include "umpire/config.hpp"
@@ -91,6 +93,116 @@ inline void Allocator::deallocate(void* ptr)
   }
 }
 
+inline void Allocator::deallocate(void* ptr, std::size_t size)
+{
+  UMPIRE_REPLAY("\"event\": \"deallocate\", \"payload\": { \"allocator_ref\": \""
+                << m_allocator << "\", \"memory_ptr\": \"" << ptr << "\" }");
+
+  UMPIRE_LOG(Debug, "(" << ptr << ", " << size << ")");
+
+  if (!ptr) {
+    UMPIRE_LOG(Info, "Deallocating a null pointer (This behavior is intentionally allowed and ignored)");
+    return;
+  }
+
+  if (m_tracking) {
+#if !defined(NDEBUG)
+    auto record = deregisterAllocation(ptr, m_allocator);
+    if (record.size != size) {
+      registerAllocation(ptr, record.size, m_allocator, record.name);
+      UMPIRE_ERROR(ptr << " was allocated with " << record.size << " bytes, not " << size);
+    }
+#else
+    deregisterAllocation(ptr, size, m_allocator);
+#endif
+  }
+
+  if (!deallocateNull(ptr)) {
+    m_allocator->deallocate(ptr, size);
+  }
+}
+
+inline void Allocator::allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs)
+{
+  UMPIRE_ASSERT(UMPIRE_VERSION_OK());
+
+  UMPIRE_LOG(Debug, "(" << count << ", " << bytes << ")");
+
+  if (0 == bytes) {
+    for (std::size_t i = 0; i < count; ++i) {
+      ptrs[i] = allocateNull();
+    }
+  } else if (count > 0) {
+    m_allocator->allocate_bulk(count, bytes, ptrs);
+  }
+
+  if (m_tracking) {
+    registerAllocations(ptrs, count, bytes, m_allocator);
+  }
+
+  // Replay each block as an allocation of its own
+  if (umpire::Replay::getReplayLogger()->replayLoggingEnabled()) {
+    for (std::size_t i = 0; i < count; ++i) {
+      UMPIRE_REPLAY("\"event\": \"allocate\", \"payload\": { \"allocator_ref\": \""
+                    << m_allocator << "\", \"size\": " << bytes << " }");
+      UMPIRE_REPLAY("\"event\": \"allocate\", \"payload\": { \"allocator_ref\": \""
+                    << m_allocator << "\", \"size\": " << bytes << " }, \"result\": { \"memory_ptr\": \"" << ptrs[i]
+                    << "\" }");
+    }
+  }
+}
+
+inline void Allocator::deallocate_bulk(void* const* ptrs, std::size_t count)
+{
+  UMPIRE_LOG(Debug, "(" << count << ")");
+
+  if (umpire::Replay::getReplayLogger()->replayLoggingEnabled()) {
+    for (std::size_t i = 0; i < count; ++i) {
+      UMPIRE_REPLAY("\"event\": \"deallocate\", \"payload\": { \"allocator_ref\": \""
+                    << m_allocator << "\", \"memory_ptr\": \"" << ptrs[i] << "\" }");
+    }
+  }
+
+  std::vector<void*> blocks;
+  blocks.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (ptrs[i]) {
+      blocks.push_back(ptrs[i]);
+    }
+  }
+
+  if (m_tracking) {
+    std::vector<util::AllocationRecord> records(blocks.size());
+    deregisterAllocations(blocks.data(), blocks.size(), m_allocator, records.data());
+
+    std::vector<std::size_t> sizes;
+    sizes.reserve(blocks.size());
+
+    std::size_t num_blocks{0};
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+      if (!deallocateNull(blocks[i])) {
+        blocks[num_blocks++] = blocks[i];
+        sizes.push_back(records[i].size);
+      }
+    }
+
+    if (num_blocks > 0) {
+      m_allocator->deallocate_bulk(blocks.data(), sizes.data(), num_blocks);
+    }
+  } else {
+    std::size_t num_blocks{0};
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+      if (!deallocateNull(blocks[i])) {
+        blocks[num_blocks++] = blocks[i];
+      }
+    }
+
+    if (num_blocks > 0) {
+      m_allocator->deallocate_bulk(blocks.data(), nullptr, num_blocks);
+    }
+  }
+}
+
 } // end of namespace umpire
 
 #endif // UMPIRE_Allocator_INL
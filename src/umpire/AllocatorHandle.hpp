@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocatorHandle_HPP
+#define UMPIRE_AllocatorHandle_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include "umpire/Allocator.hpp"
+
+namespace umpire {
+
+/*!
+ * \brief Cached lookup of the Allocator registered under a name.
+ *
+ * ResourceManager::getAllocator(name) hashes the name on every call. An
+ * AllocatorHandle does that once, and afterwards only checks that no
+ * allocator or alias has been registered since, so it is cheap enough to
+ * call get() wherever the Allocator is needed. A handle may be shared between
+ * threads.
+ *
+ * \code
+ * static umpire::AllocatorHandle pool{"DEVICE_POOL"};
+ * void* data = pool.get().allocate(1024);
+ * \endcode
+ */
+class AllocatorHandle {
+ public:
+  /*!
+   * \brief Look up the Allocator registered under name.
+   *
+   * Throws if there is none, as ResourceManager::getAllocator does.
+   */
+  explicit AllocatorHandle(const std::string& name);
+
+  AllocatorHandle(const AllocatorHandle& other);
+  AllocatorHandle& operator=(const AllocatorHandle& other);
+
+  /*!
+   * \brief Get the Allocator currently registered under the name.
+   */
+  Allocator get() const;
+
+  const std::string& getName() const noexcept;
+
+ private:
+  void resolve(std::size_t version) const;
+
+  std::string m_name;
+  mutable std::atomic<strategy::AllocationStrategy*> m_strategy{nullptr};
+  mutable std::atomic<std::size_t> m_version{0};
+};
+
+} // end of namespace umpire
+
+#include "umpire/AllocatorHandle.inl"
+
+#endif // UMPIRE_AllocatorHandle_HPP
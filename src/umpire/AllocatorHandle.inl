@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocatorHandle_INL
+#define UMPIRE_AllocatorHandle_INL
+
+#include "umpire/ResourceManager.hpp"
+
+namespace umpire {
+
+inline AllocatorHandle::AllocatorHandle(const std::string& name) : m_name{name}
+{
+  resolve(ResourceManager::getInstance().m_registry.version());
+}
+
+inline AllocatorHandle::AllocatorHandle(const AllocatorHandle& other)
+    : m_name{other.m_name},
+      m_strategy{other.m_strategy.load(std::memory_order_relaxed)},
+      m_version{other.m_version.load(std::memory_order_acquire)}
+{
+}
+
+inline AllocatorHandle& AllocatorHandle::operator=(const AllocatorHandle& other)
+{
+  if (this != &other) {
+    m_name = other.m_name;
+    resolve(ResourceManager::getInstance().m_registry.version());
+  }
+
+  return *this;
+}
+
+inline Allocator AllocatorHandle::get() const
+{
+  const std::size_t version{ResourceManager::getInstance().m_registry.version()};
+
+  if (version != m_version.load(std::memory_order_acquire)) {
+    resolve(version);
+  }
+
+  return Allocator{m_strategy.load(std::memory_order_relaxed)};
+}
+
+inline const std::string& AllocatorHandle::getName() const noexcept
+{
+  return m_name;
+}
+
+inline void AllocatorHandle::resolve(std::size_t version) const
+{
+  // version was read before the lookup, so a registration that races with it
+  // leaves the handle stale and the next get() resolves again
+  m_strategy.store(ResourceManager::getInstance().getAllocationStrategy(m_name), std::memory_order_relaxed);
+  m_version.store(version, std::memory_order_release);
+}
+
+} // end of namespace umpire
+
+#endif // UMPIRE_AllocatorHandle_INL
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocatorResource_HPP
+#define UMPIRE_AllocatorResource_HPP
+
+//
+// The std::pmr adapters need C++17 and a standard library that provides
+// <memory_resource>. Umpire itself does not, so this header is only used by
+// applications built with C++17, and is empty otherwise.
+//
+#if (__cplusplus >= 201703L) && defined(__has_include)
+#if __has_include(<memory_resource>)
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "umpire/Allocator.hpp"
+
+namespace umpire {
+namespace pmr {
+
+/*!
+ * \brief std::pmr::memory_resource that allocates from an Allocator.
+ *
+ * Any Allocator can be used with std::pmr containers through this adapter,
+ * and as the upstream resource of the std::pmr pool and monotonic resources,
+ * so that containers of many small nodes only go to the Allocator for large
+ * slabs (see SynchronizedPoolResource, UnsynchronizedPoolResource and
+ * MonotonicBufferResource).
+ *
+ * Alignments up to alignof(std::max_align_t) are left to the Allocator.
+ * Larger alignments are satisfied by over-allocating.
+ */
+class AllocatorResource : public std::pmr::memory_resource {
+ public:
+  /*!
+   * \brief Construct a new AllocatorResource that will use allocator to
+   * allocate memory.
+   */
+  explicit AllocatorResource(Allocator allocator) noexcept;
+
+  Allocator getAllocator() const noexcept;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  Allocator m_allocator;
+};
+
+namespace detail {
+
+//
+// Holds the upstream AllocatorResource of a std::pmr resource. It is a base
+// class listed before the std::pmr resource, so that it is constructed first
+// and destroyed last.
+//
+struct UpstreamResource {
+  explicit UpstreamResource(Allocator allocator) noexcept : upstream{allocator}
+  {
+  }
+
+  AllocatorResource upstream;
+};
+
+} // end of namespace detail
+
+/*!
+ * \brief Thread-safe std::pmr pool resource that gets its slabs from an
+ * Allocator.
+ */
+class SynchronizedPoolResource : private detail::UpstreamResource, public std::pmr::synchronized_pool_resource {
+ public:
+  explicit SynchronizedPoolResource(Allocator allocator, const std::pmr::pool_options& options = {});
+
+  Allocator getAllocator() const noexcept;
+};
+
+/*!
+ * \brief std::pmr pool resource for use by a single thread that gets its
+ * slabs from an Allocator.
+ */
+class UnsynchronizedPoolResource : private detail::UpstreamResource, public std::pmr::unsynchronized_pool_resource {
+ public:
+  explicit UnsynchronizedPoolResource(Allocator allocator, const std::pmr::pool_options& options = {});
+
+  Allocator getAllocator() const noexcept;
+};
+
+/*!
+ * \brief std::pmr monotonic resource that gets its buffers from an
+ * Allocator, and only gives them back when it is released or destroyed.
+ */
+class MonotonicBufferResource : private detail::UpstreamResource, public std::pmr::monotonic_buffer_resource {
+ public:
+  explicit MonotonicBufferResource(Allocator allocator);
+  MonotonicBufferResource(Allocator allocator, std::size_t initial_size);
+
+  Allocator getAllocator() const noexcept;
+};
+
+} // end of namespace pmr
+} // end of namespace umpire
+
+#include "umpire/AllocatorResource.inl"
+
+#endif // __has_include(<memory_resource>)
+#endif // (__cplusplus >= 201703L) && defined(__has_include)
+
+#endif // UMPIRE_AllocatorResource_HPP
@@ -0,0 +1,95 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocatorResource_INL
+#define UMPIRE_AllocatorResource_INL
+
+#include <cstdint>
+
+namespace umpire {
+namespace pmr {
+
+inline AllocatorResource::AllocatorResource(Allocator allocator) noexcept : m_allocator{allocator}
+{
+}
+
+inline Allocator AllocatorResource::getAllocator() const noexcept
+{
+  return m_allocator;
+}
+
+inline void* AllocatorResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  if (alignment <= alignof(std::max_align_t)) {
+    return m_allocator.allocate(bytes);
+  }
+
+  //
+  // Over-allocate, and keep the pointer returned by the Allocator just below
+  // the aligned pointer
+  //
+  void* ptr{m_allocator.allocate(bytes + alignment)};
+  const std::uintptr_t aligned{(reinterpret_cast<std::uintptr_t>(ptr) + alignment) & ~(alignment - 1)};
+  reinterpret_cast<void**>(aligned)[-1] = ptr;
+
+  return reinterpret_cast<void*>(aligned);
+}
+
+inline void AllocatorResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+  if (alignment <= alignof(std::max_align_t)) {
+    m_allocator.deallocate(ptr, bytes);
+  } else {
+    m_allocator.deallocate(static_cast<void**>(ptr)[-1], bytes + alignment);
+  }
+}
+
+inline bool AllocatorResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+  auto other_resource = dynamic_cast<const AllocatorResource*>(&other);
+  return (other_resource != nullptr) && (other_resource->m_allocator.getId() == m_allocator.getId());
+}
+
+inline SynchronizedPoolResource::SynchronizedPoolResource(Allocator allocator, const std::pmr::pool_options& options)
+    : detail::UpstreamResource{allocator}, std::pmr::synchronized_pool_resource{options, &upstream}
+{
+}
+
+inline Allocator SynchronizedPoolResource::getAllocator() const noexcept
+{
+  return upstream.getAllocator();
+}
+
+inline UnsynchronizedPoolResource::UnsynchronizedPoolResource(Allocator allocator,
+                                                              const std::pmr::pool_options& options)
+    : detail::UpstreamResource{allocator}, std::pmr::unsynchronized_pool_resource{options, &upstream}
+{
+}
+
+inline Allocator UnsynchronizedPoolResource::getAllocator() const noexcept
+{
+  return upstream.getAllocator();
+}
+
+inline MonotonicBufferResource::MonotonicBufferResource(Allocator allocator)
+    : detail::UpstreamResource{allocator}, std::pmr::monotonic_buffer_resource{&upstream}
+{
+}
+
+inline MonotonicBufferResource::MonotonicBufferResource(Allocator allocator, std::size_t initial_size)
+    : detail::UpstreamResource{allocator}, std::pmr::monotonic_buffer_resource{initial_size, &upstream}
+{
+}
+
+inline Allocator MonotonicBufferResource::getAllocator() const noexcept
+{
+  return upstream.getAllocator();
+}
+
+} // end of namespace pmr
+} // end of namespace umpire
+
+#endif // UMPIRE_AllocatorResource_INL
@@ -54,9 +54,9 @@ ResourceManager& ResourceManager::getInstance()
 
 ResourceManager::ResourceManager()
     : m_allocations(),
+      m_owned_ranges(),
       m_allocators(),
-      m_allocators_by_id(),
-      m_allocators_by_name(),
+      m_registry(),
       m_memory_resources(),
       m_id(0),
       m_mutex()
@@ -141,10 +141,17 @@ Allocator ResourceManager::makeResource(const std::string& name)
 
 Allocator ResourceManager::makeResource(const std::string& name, MemoryResourceTraits traits)
 {
-  if (m_allocators_by_name.find(name) != m_allocators_by_name.end()) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_registry.find(name)) {
     UMPIRE_ERROR("Allocator " << name << " already exists, and cannot be re-created.");
   }
 
+  return Allocator{createResource(name, traits)};
+}
+
+strategy::AllocationStrategy* ResourceManager::createResource(const std::string& name, MemoryResourceTraits traits)
+{
   resource::MemoryResourceRegistry& registry{resource::MemoryResourceRegistry::getInstance()};
 
   if (name.find("DEVICE") != std::string::npos) {
@@ -156,41 +163,52 @@ Allocator ResourceManager::makeResource(const std::string& name, MemoryResourceT
                                                                             << R"(, "result": ")" << allocator.get()
                                                                             << R"(")");
 
-  int id{allocator->getId()};
-  m_allocators_by_name[name] = allocator.get();
-  if (name == "DEVICE") {
-    m_allocators_by_name["DEVICE::0"] = allocator.get();
-  }
-  if (name.find("::0") != std::string::npos) {
-    std::string base_name{name.substr(0, name.find("::") - 1)};
-    m_allocators_by_name[base_name] = allocator.get();
-  }
+  strategy::AllocationStrategy* strategy{allocator.get()};
+  m_registry.update([&](util::AllocatorRegistry::Snapshot& snapshot) {
+    snapshot.names[name] = strategy;
+    if (name == "DEVICE") {
+      snapshot.names["DEVICE::0"] = strategy;
+    }
+    if (name.find("::0") != std::string::npos) {
+      std::string base_name{name.substr(0, name.find("::") - 1)};
+      snapshot.names[base_name] = strategy;
+    }
+    snapshot.ids[strategy->getId()] = strategy;
+  });
+
   if (name.find("::") == std::string::npos) {
-    m_memory_resources[resource::string_to_resource(name)] = allocator.get();
+    m_memory_resources[resource::string_to_resource(name)] = strategy;
   }
-  m_allocators_by_id[id] = allocator.get();
   m_allocators.emplace_front(std::move(allocator));
 
-  return Allocator{m_allocators_by_name[name]};
+  return strategy;
 }
 
 strategy::AllocationStrategy* ResourceManager::getAllocationStrategy(const std::string& name)
 {
-  resource::MemoryResourceRegistry& registry{resource::MemoryResourceRegistry::getInstance()};
-  auto resource_names = registry.getResourceNames();
-
   UMPIRE_LOG(Debug, "(\"" << name << "\")");
-  auto allocator = m_allocators_by_name.find(name);
-  if (allocator == m_allocators_by_name.end()) {
-    auto resource_name = std::find(resource_names.begin(), resource_names.end(), name);
-    if (resource_name != std::end(resource_names)) {
-      makeResource(name);
-    } else {
+
+  strategy::AllocationStrategy* allocator{m_registry.find(name)};
+  if (allocator) {
+    return allocator;
+  }
+
+  // Resources are created on first use, once
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  allocator = m_registry.find(name);
+  if (!allocator) {
+    resource::MemoryResourceRegistry& registry{resource::MemoryResourceRegistry::getInstance()};
+    auto resource_names = registry.getResourceNames();
+
+    if (std::find(resource_names.begin(), resource_names.end(), name) == std::end(resource_names)) {
       UMPIRE_ERROR("Allocator \"" << name << "\" not found. Available allocators: " << getAllocatorInformation());
     }
+
+    allocator = createResource(name, registry.getDefaultTraitsForResource(name));
   }
 
-  return m_allocators_by_name[name];
+  return allocator;
 }
 
 Allocator ResourceManager::getAllocator(const std::string& name)
@@ -224,12 +242,12 @@ Allocator ResourceManager::getAllocator(int id)
     UMPIRE_ERROR("Passed umpire::invalid_allocator_id");
   }
 
-  auto allocator = m_allocators_by_id.find(id);
-  if (allocator == m_allocators_by_id.end()) {
+  strategy::AllocationStrategy* allocator{m_registry.find(id)};
+  if (!allocator) {
     UMPIRE_ERROR("Allocator \"" << id << "\" not found. Available allocators: " << getAllocatorInformation());
   }
 
-  return Allocator(m_allocators_by_id[id]);
+  return Allocator(allocator);
 }
 
 Allocator ResourceManager::getDefaultAllocator()
@@ -268,7 +286,14 @@ void ResourceManager::addAlias(const std::string& name, Allocator allocator)
     UMPIRE_ERROR("Allocator " << name << " is already an alias for " << ra.getName());
   }
 
-  m_allocators_by_name[name] = allocator.getAllocationStrategy();
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (auto existing = m_registry.find(name)) {
+    UMPIRE_ERROR("Allocator " << name << " is already an alias for " << existing->getName());
+  }
+
+  m_registry.update(
+      [&](util::AllocatorRegistry::Snapshot& snapshot) { snapshot.names[name] = allocator.getAllocationStrategy(); });
 }
 
 void ResourceManager::removeAlias(const std::string& name, Allocator allocator)
@@ -277,16 +302,22 @@ void ResourceManager::removeAlias(const std::string& name, Allocator allocator)
     UMPIRE_ERROR("Allocator " << name << " is not registered.");
   }
 
-  auto a = m_allocators_by_name.find(name);
-  if (a->second->getName().compare(name) == 0) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto a = m_registry.find(name);
+  if (!a) {
+    UMPIRE_ERROR("Allocator " << name << " is not registered.");
+  }
+
+  if (a->getName().compare(name) == 0) {
     UMPIRE_ERROR(name << " is not an alias, so cannot be removed.")
   }
 
-  if (a->second->getId() != allocator.getId()) {
+  if (a->getId() != allocator.getId()) {
     UMPIRE_ERROR("Allocator " << name << " is not registered as an alias of " << allocator.getName());
   }
 
-  m_allocators_by_name.erase(a);
+  m_registry.update([&](util::AllocatorRegistry::Snapshot& snapshot) { snapshot.names.erase(name); });
 }
 
 Allocator ResourceManager::getAllocator(void* ptr)
@@ -297,23 +328,26 @@ Allocator ResourceManager::getAllocator(void* ptr)
 
 bool ResourceManager::isAllocator(const std::string& name) noexcept
 {
+  if (m_registry.find(name)) {
+    return true;
+  }
+
   resource::MemoryResourceRegistry& registry{resource::MemoryResourceRegistry::getInstance()};
   auto resource_names = registry.getResourceNames();
 
-  return (m_allocators_by_name.find(name) != m_allocators_by_name.end() ||
-          std::find(resource_names.begin(), resource_names.end(), name) != std::end(resource_names));
+  return std::find(resource_names.begin(), resource_names.end(), name) != std::end(resource_names);
 }
 
 bool ResourceManager::isAllocator(int id) noexcept
 {
-  return (m_allocators_by_id.find(id) != m_allocators_by_id.end());
+  return m_registry.find(id) != nullptr;
 }
 
 bool ResourceManager::hasAllocator(void* ptr)
 {
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
 
-  return m_allocations.contains(ptr);
+  return (findOwnedRecord(ptr) != nullptr) || m_allocations.contains(ptr);
 }
 
 void ResourceManager::registerAllocation(void* ptr, util::AllocationRecord record)
@@ -327,18 +361,127 @@ void ResourceManager::registerAllocation(void* ptr, util::AllocationRecord recor
 
   UMPIRE_RECORD_BACKTRACE(record);
 
+  if (record.strategy && record.strategy->ownsAllocationRecords()) {
+    record.ptr = ptr;
+    if (record.strategy->insertAllocationRecord(record)) {
+      return;
+    }
+  }
+
   m_allocations.insert(ptr, record);
 }
 
 util::AllocationRecord ResourceManager::deregisterAllocation(void* ptr)
 {
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  auto owner = findRangeOwner(ptr);
+  util::AllocationRecord record;
+  if (owner && owner->removeAllocationRecord(ptr, &record)) {
+    return record;
+  }
+
   return m_allocations.remove(ptr);
 }
 
+void ResourceManager::eraseAllocation(void* ptr)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  auto owner = findRangeOwner(ptr);
+  if (owner && owner->removeAllocationRecord(ptr, nullptr)) {
+    return;
+  }
+
+  m_allocations.erase(ptr);
+}
+
+void ResourceManager::registerAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord record)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!ptrs[i]) {
+      UMPIRE_ERROR("Cannot register nullptr!");
+    }
+  }
+
+  UMPIRE_LOG(Debug, "(count=" << count << ", size=" << record.size << ", strategy=" << record.strategy << ") with "
+                              << this);
+
+  UMPIRE_RECORD_BACKTRACE(record);
+
+  if (record.strategy && record.strategy->ownsAllocationRecords()) {
+    for (std::size_t i = 0; i < count; ++i) {
+      record.ptr = ptrs[i];
+      if (!record.strategy->insertAllocationRecord(record)) {
+        m_allocations.insert(ptrs[i], record);
+      }
+    }
+  } else {
+    m_allocations.insert(ptrs, count, record);
+  }
+}
+
+void ResourceManager::deregisterAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord* records)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+
+  if (m_owned_ranges.size() == 0) {
+    m_allocations.remove(ptrs, count, records);
+    return;
+  }
+
+  // Take the owned records first, and remove the rest from the map at once
+  std::vector<std::size_t> unowned;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto owner = findRangeOwner(ptrs[i]);
+    if (!(owner && owner->removeAllocationRecord(ptrs[i], &records[i]))) {
+      unowned.push_back(i);
+    }
+  }
+
+  if (!unowned.empty()) {
+    std::vector<void*> unowned_ptrs;
+    std::vector<util::AllocationRecord> unowned_records(unowned.size());
+    for (auto i : unowned) {
+      unowned_ptrs.push_back(ptrs[i]);
+    }
+
+    try {
+      m_allocations.remove(unowned_ptrs.data(), unowned_ptrs.size(), unowned_records.data());
+    } catch (...) {
+      // Put back the owned records taken so far
+      std::size_t next_unowned{0};
+      for (std::size_t i = 0; i < count; ++i) {
+        if (next_unowned < unowned.size() && unowned[next_unowned] == i) {
+          ++next_unowned;
+        } else {
+          records[i].strategy->insertAllocationRecord(records[i]);
+        }
+      }
+      throw;
+    }
+
+    for (std::size_t j = 0; j < unowned.size(); ++j) {
+      records[unowned[j]] = unowned_records[j];
+    }
+  }
+}
+
+bool ResourceManager::registerOwnedRange(void* ptr, std::size_t size, strategy::AllocationStrategy* owner)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", size=" << size << ", owner=" << owner << ")");
+  return m_owned_ranges.insert(ptr, size, owner);
+}
+
+void ResourceManager::deregisterOwnedRange(void* ptr)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+  m_owned_ranges.remove(ptr);
+}
+
 const util::AllocationRecord* ResourceManager::findAllocationRecord(void* ptr) const
 {
-  auto alloc_record = m_allocations.find(ptr);
+  auto alloc_record = findRecord(ptr);
 
   if (!alloc_record->strategy) {
     UMPIRE_ERROR("Cannot find allocator for " << ptr);
@@ -349,17 +492,58 @@ const util::AllocationRecord* ResourceManager::findAllocationRecord(void* ptr) c
   return alloc_record;
 }
 
+util::AllocationRecord* ResourceManager::findRecord(void* ptr) const
+{
+  auto owned_record = findOwnedRecord(ptr);
+  if (owned_record && owned_record->ptr == ptr) {
+    return owned_record;
+  }
+
+  // Allocations registered inside an owned range take precedence for offset
+  // pointers, as they would in the map
+  auto record = const_cast<util::AllocationRecord*>(m_allocations.findRecord(ptr));
+
+  if (!record) {
+    record = owned_record;
+  }
+
+  if (!record) {
+    // Throws, with the contents of the map in debug builds
+    record = const_cast<util::AllocationRecord*>(m_allocations.find(ptr));
+  }
+
+  return record;
+}
+
+util::AllocationRecord* ResourceManager::findOwnedRecord(void* ptr) const noexcept
+{
+  // Only strategies holding records register ranges, and they look the
+  // records up under their own lock
+  auto owner = findRangeOwner(ptr);
+  if (!owner) {
+    return nullptr;
+  }
+
+  auto record = owner->findAllocationRecord(ptr);
+  return (record && record->strategy == owner) ? record : nullptr;
+}
+
+strategy::AllocationStrategy* ResourceManager::findRangeOwner(void* ptr) const noexcept
+{
+  return m_owned_ranges.find(ptr);
+}
+
 void ResourceManager::copy(void* dst_ptr, void* src_ptr, std::size_t size)
 {
   UMPIRE_LOG(Debug, "(src_ptr=" << src_ptr << ", dst_ptr=" << dst_ptr << ", size=" << size << ")");
 
   auto& op_registry = op::MemoryOperationRegistry::getInstance();
 
-  auto src_alloc_record = m_allocations.find(src_ptr);
+  auto src_alloc_record = findRecord(src_ptr);
   std::ptrdiff_t src_offset = static_cast<char*>(src_ptr) - static_cast<char*>(src_alloc_record->ptr);
   std::size_t src_size = src_alloc_record->size - src_offset;
 
-  auto dst_alloc_record = m_allocations.find(dst_ptr);
+  auto dst_alloc_record = findRecord(dst_ptr);
   std::ptrdiff_t dst_offset = static_cast<char*>(dst_ptr) - static_cast<char*>(dst_alloc_record->ptr);
   std::size_t dst_size = dst_alloc_record->size - dst_offset;
 
@@ -392,11 +576,11 @@ camp::resources::EventProxy<camp::resources::Resource> ResourceManager::copy(voi
 
   auto& op_registry = op::MemoryOperationRegistry::getInstance();
 
-  auto src_alloc_record = m_allocations.find(src_ptr);
+  auto src_alloc_record = findRecord(src_ptr);
   std::ptrdiff_t src_offset = static_cast<char*>(src_ptr) - static_cast<char*>(src_alloc_record->ptr);
   std::size_t src_size = src_alloc_record->size - src_offset;
 
-  auto dst_alloc_record = m_allocations.find(dst_ptr);
+  auto dst_alloc_record = findRecord(dst_ptr);
   std::ptrdiff_t dst_offset = static_cast<char*>(dst_ptr) - static_cast<char*>(dst_alloc_record->ptr);
   std::size_t dst_size = dst_alloc_record->size - dst_offset;
 
@@ -419,7 +603,7 @@ void ResourceManager::memset(void* ptr, int value, std::size_t length)
 
   auto& op_registry = op::MemoryOperationRegistry::getInstance();
 
-  auto alloc_record = m_allocations.find(ptr);
+  auto alloc_record = findRecord(ptr);
 
   std::ptrdiff_t offset = static_cast<char*>(ptr) - static_cast<char*>(alloc_record->ptr);
   std::size_t size = alloc_record->size - offset;
@@ -451,7 +635,7 @@ camp::resources::EventProxy<camp::resources::Resource> ResourceManager::memset(v
 
   auto& op_registry = op::MemoryOperationRegistry::getInstance();
 
-  auto alloc_record = m_allocations.find(ptr);
+  auto alloc_record = findRecord(ptr);
 
   std::ptrdiff_t offset = static_cast<char*>(ptr) - static_cast<char*>(alloc_record->ptr);
   std::size_t size = alloc_record->size - offset;
@@ -474,7 +658,7 @@ void* ResourceManager::reallocate(void* current_ptr, std::size_t new_size)
   strategy::AllocationStrategy* strategy;
 
   if (current_ptr != nullptr) {
-    auto alloc_record = m_allocations.find(current_ptr);
+    auto alloc_record = findRecord(current_ptr);
     strategy = alloc_record->strategy;
   } else {
     strategy = getDefaultAllocator().getAllocationStrategy();
@@ -499,7 +683,7 @@ void* ResourceManager::reallocate(void* current_ptr, std::size_t new_size, camp:
   strategy::AllocationStrategy* strategy;
 
   if (current_ptr != nullptr) {
-    auto alloc_record = m_allocations.find(current_ptr);
+    auto alloc_record = findRecord(current_ptr);
     strategy = alloc_record->strategy;
   } else {
     strategy = getDefaultAllocator().getAllocationStrategy();
@@ -549,7 +733,7 @@ void* ResourceManager::reallocate_impl(void* current_ptr, std::size_t new_size,
   if (current_ptr == nullptr) {
     new_ptr = allocator.allocate(new_size);
   } else {
-    auto alloc_record = m_allocations.find(current_ptr);
+    auto alloc_record = findRecord(current_ptr);
     auto alloc = Allocator(alloc_record->strategy);
 
     if (alloc_record->strategy != allocator.getAllocationStrategy()) {
@@ -599,7 +783,7 @@ void* ResourceManager::reallocate_impl(void* current_ptr, std::size_t new_size,
   if (current_ptr == nullptr) {
     new_ptr = allocator.allocate(new_size);
   } else {
-    auto alloc_record = m_allocations.find(current_ptr);
+    auto alloc_record = findRecord(current_ptr);
     auto alloc = Allocator(alloc_record->strategy);
 
     if (alloc_record->strategy != allocator.getAllocationStrategy()) {
@@ -643,7 +827,7 @@ void* ResourceManager::move(void* ptr, Allocator allocator)
                 << R"( "ptr": ")" << ptr << R"(")"
                 << R"(, "allocator_ref": ")" << allocator.getAllocationStrategy() << R"(" })");
 
-  auto alloc_record = m_allocations.find(ptr);
+  auto alloc_record = findRecord(ptr);
 
   // short-circuit if ptr was allocated by 'allocator'
   if (alloc_record->strategy == allocator.getAllocationStrategy()) {
@@ -659,7 +843,7 @@ void* ResourceManager::move(void* ptr, Allocator allocator)
     if (dynamic_cast<strategy::NumaPolicy*>(base_strategy)) {
       auto& op_registry = op::MemoryOperationRegistry::getInstance();
 
-      auto src_alloc_record = m_allocations.find(ptr);
+      auto src_alloc_record = findRecord(ptr);
 
       const std::size_t size{src_alloc_record->size};
       util::AllocationRecord dst_alloc_record{nullptr, size, allocator.getAllocationStrategy()};
@@ -703,10 +887,12 @@ camp::resources::EventProxy<camp::resources::Resource> ResourceManager::prefetch
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ", device=" << device << ")");
 
   auto& op_registry = op::MemoryOperationRegistry::getInstance();
-  auto alloc_record = m_allocations.find(ptr);
+  auto alloc_record = findRecord(ptr);
 
-  if (alloc_record->strategy->getTraits().resource != umpire::MemoryResourceTraits::resource_type::um) {
-    UMPIRE_ERROR("ResourceManager::prefetch only works on allocations from a UM resource.");
+  const auto resource = alloc_record->strategy->getTraits().resource;
+  if (resource != umpire::MemoryResourceTraits::resource_type::um &&
+      resource != umpire::MemoryResourceTraits::resource_type::file) {
+    UMPIRE_ERROR("ResourceManager::prefetch only works on allocations from a UM or FILE resource.");
   }
 
   std::ptrdiff_t offset = static_cast<char*>(ptr) - static_cast<char*>(alloc_record->ptr);
@@ -726,26 +912,26 @@ void ResourceManager::deallocate(void* ptr)
 
 std::size_t ResourceManager::getSize(void* ptr) const
 {
-  auto record = m_allocations.find(ptr);
+  auto record = findRecord(ptr);
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ") returning " << record->size);
   return record->size;
 }
 
 strategy::AllocationStrategy* ResourceManager::findAllocatorForId(int id)
 {
-  auto allocator_i = m_allocators_by_id.find(id);
+  strategy::AllocationStrategy* allocator{m_registry.find(id)};
 
-  if (allocator_i == m_allocators_by_id.end()) {
+  if (!allocator) {
     UMPIRE_ERROR("Cannot find allocator for ID " << id);
   }
 
-  UMPIRE_LOG(Debug, "(id=" << id << ") returning " << allocator_i->second);
-  return allocator_i->second;
+  UMPIRE_LOG(Debug, "(id=" << id << ") returning " << allocator);
+  return allocator;
 }
 
 strategy::AllocationStrategy* ResourceManager::findAllocatorForPointer(void* ptr)
 {
-  auto allocation_record = m_allocations.find(ptr);
+  auto allocation_record = findRecord(ptr);
 
   if (!allocation_record->strategy) {
     UMPIRE_ERROR("Cannot find allocator " << ptr);
@@ -758,7 +944,8 @@ strategy::AllocationStrategy* ResourceManager::findAllocatorForPointer(void* ptr
 std::vector<std::string> ResourceManager::getAllocatorNames() const noexcept
 {
   std::vector<std::string> names;
-  for (auto it = m_allocators_by_name.begin(); it != m_allocators_by_name.end(); ++it) {
+  const auto snapshot = m_registry.copy();
+  for (auto it = snapshot.names.begin(); it != snapshot.names.end(); ++it) {
     names.push_back(it->first);
   }
 
@@ -769,7 +956,8 @@ std::vector<std::string> ResourceManager::getAllocatorNames() const noexcept
 std::vector<int> ResourceManager::getAllocatorIds() const noexcept
 {
   std::vector<int> ids;
-  for (auto& it : m_allocators_by_id) {
+  const auto snapshot = m_registry.copy();
+  for (auto& it : snapshot.ids) {
     ids.push_back(it.first);
   }
 
@@ -785,7 +973,8 @@ std::string ResourceManager::getAllocatorInformation() const noexcept
 {
   std::ostringstream info;
 
-  for (auto& it : m_allocators_by_name) {
+  const auto snapshot = m_registry.copy();
+  for (auto& it : snapshot.names) {
     info << *it.second << " ";
   }
 
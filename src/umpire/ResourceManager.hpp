@@ -19,10 +19,14 @@
 #include "umpire/Tracking.hpp"
 #include "umpire/resource/MemoryResourceTypes.hpp"
 #include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/util/AddressRangeIndex.hpp"
 #include "umpire/util/AllocationMap.hpp"
+#include "umpire/util/AllocatorRegistry.hpp"
 
 namespace umpire {
 
+class AllocatorHandle;
+
 namespace op {
 class MemoryOperation;
 }
@@ -181,6 +185,42 @@ class ResourceManager {
    */
   util::AllocationRecord deregisterAllocation(void* ptr);
 
+  /*!
+   * \brief de-register the address ptr with the manager, without returning
+   * its allocation record.
+   */
+  void eraseAllocation(void* ptr);
+
+  /*!
+   * \brief register count allocations, all described by record, with the
+   * manager at once.
+   */
+  void registerAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord record);
+
+  /*!
+   * \brief de-register count addresses with the manager at once, writing the
+   * removed allocation records to records.
+   */
+  void deregisterAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord* records);
+
+  /*!
+   * \brief register a range of addresses whose allocations are recorded by
+   * owner rather than by the manager.
+   *
+   * \return false if the range overlaps one already registered, such as a
+   * block of a pool that allocates from another pool. The allocations in the
+   * range must then be recorded by the manager.
+   *
+   * \see strategy::AllocationStrategy::ownsAllocationRecords
+   */
+  bool registerOwnedRange(void* ptr, std::size_t size, strategy::AllocationStrategy* owner);
+
+  /*!
+   * \brief de-register a range of addresses registered with
+   * registerOwnedRange.
+   */
+  void deregisterOwnedRange(void* ptr);
+
   /*!
    * \brief Find the allocation record associated with an address ptr.
    *
@@ -283,6 +323,10 @@ class ResourceManager {
   /*!
    * \brief Asynchronously prefetch memory ptr to device.
    *
+   * For allocations from a FILE resource, the pages from ptr to the end of the
+   * allocation are read from the file in the background and device is
+   * ignored.
+   *
    * \param ptr Pointer to prefech
    * \param device Device to prefetch data to
    * \param ctx Resource to use for asynchronous operation
@@ -312,9 +356,16 @@ class ResourceManager {
   ResourceManager();
 
   strategy::AllocationStrategy* findAllocatorForPointer(void* ptr);
+
+  util::AllocationRecord* findRecord(void* ptr) const;
+  util::AllocationRecord* findOwnedRecord(void* ptr) const noexcept;
+  strategy::AllocationStrategy* findRangeOwner(void* ptr) const noexcept;
   strategy::AllocationStrategy* findAllocatorForId(int id);
   strategy::AllocationStrategy* getAllocationStrategy(const std::string& name);
 
+  // Create and register the resource name, with m_mutex held
+  strategy::AllocationStrategy* createResource(const std::string& name, MemoryResourceTraits traits);
+
   int getNextId() noexcept;
 
   std::string getAllocatorInformation() const noexcept;
@@ -327,10 +378,14 @@ class ResourceManager {
 
   util::AllocationMap m_allocations;
 
+  // Address ranges of the strategies that own their allocation records
+  util::AddressRangeIndex m_owned_ranges;
+
   std::list<std::unique_ptr<strategy::AllocationStrategy>> m_allocators;
 
-  std::unordered_map<int, strategy::AllocationStrategy*> m_allocators_by_id;
-  std::unordered_map<std::string, strategy::AllocationStrategy*> m_allocators_by_name;
+  // Names and ids of the allocators in m_allocators, readable without m_mutex
+  util::AllocatorRegistry m_registry;
+
   std::unordered_map<resource::MemoryResourceType, strategy::AllocationStrategy*, resource::MemoryResourceTypeHash>
       m_memory_resources;
 
@@ -347,6 +402,7 @@ class ResourceManager {
   friend std::vector<util::AllocationRecord> get_allocator_records(Allocator);
   friend strategy::ZeroByteHandler;
   friend strategy::mixins::AllocateNull;
+  friend AllocatorHandle;
 };
 
 } // end namespace umpire
@@ -47,11 +47,14 @@ Allocator ResourceManager::makeAllocator(const std::string& name, Tracking track
                 << ", \"args\": [ " << umpire::Replay::printReplayAllocator(std::forward<Args>(args)...) << " ] }"
                 << ", \"result\": { \"allocator_ref\":\"" << allocator.get() << "\" }");
 
-  m_allocators_by_name[name] = allocator.get();
-  m_allocators_by_id[allocator->getId()] = allocator.get();
+  strategy::AllocationStrategy* strategy{allocator.get()};
+  m_registry.update([&](util::AllocatorRegistry::Snapshot& snapshot) {
+    snapshot.names[name] = strategy;
+    snapshot.ids[strategy->getId()] = strategy;
+  });
   m_allocators.emplace_front(std::move(allocator));
 
-  return Allocator(m_allocators_by_name[name]);
+  return Allocator(strategy);
 }
 
 template <typename Strategy, bool introspection, typename... Args>
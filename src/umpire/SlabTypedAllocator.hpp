@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_SlabTypedAllocator_HPP
+#define UMPIRE_SlabTypedAllocator_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+
+// forward declarations
+
+namespace umpire {
+
+template <typename T>
+class SlabTypedAllocator;
+
+}
+
+template <typename U, typename V>
+bool operator==(const umpire::SlabTypedAllocator<U>&, const umpire::SlabTypedAllocator<V>&);
+
+template <typename U, typename V>
+bool operator!=(const umpire::SlabTypedAllocator<U>&, const umpire::SlabTypedAllocator<V>&);
+
+namespace umpire {
+
+namespace detail {
+
+/*!
+ * \brief Free lists of small objects carved out of slabs from an Allocator.
+ *
+ * Objects are grouped in size classes of alignof(std::max_align_t) bytes.
+ * Each size class has a free list threaded through its free objects, and
+ * objects are taken from the free list, or else carved from the end of the
+ * current slab. Slabs are only returned to the Allocator when the cache is
+ * destroyed.
+ */
+class SlabCache {
+ public:
+  static constexpr std::size_t s_granularity{alignof(std::max_align_t)};
+  static constexpr std::size_t s_max_object_size{256};
+
+  SlabCache(Allocator allocator, std::size_t slab_size) noexcept;
+  ~SlabCache();
+
+  SlabCache(const SlabCache&) = delete;
+  SlabCache& operator=(const SlabCache&) = delete;
+
+  /*!
+   * \brief Return whether objects of bytes are taken from the slabs, rather
+   * than from the Allocator directly.
+   */
+  static bool fits(std::size_t bytes) noexcept;
+
+  void* allocate(std::size_t bytes);
+  void deallocate(void* ptr, std::size_t bytes) noexcept;
+
+  Allocator& getAllocator() noexcept;
+
+ private:
+  struct FreeObject {
+    FreeObject* next;
+  };
+
+  static std::size_t sizeClass(std::size_t bytes) noexcept;
+
+  Allocator m_allocator;
+  const std::size_t m_slab_size;
+
+  std::array<FreeObject*, s_max_object_size / s_granularity> m_free_lists{};
+  std::vector<void*> m_slabs{};
+  char* m_slab_top{nullptr};
+  std::size_t m_slab_remaining{0};
+};
+
+} // end of namespace detail
+
+/*!
+ * \brief Allocator for objects of type T, suited to node-based containers.
+ *
+ * Like TypedAllocator, this adapts an Allocator to the standard allocator
+ * interface. Allocations of a single small object, such as the nodes of a
+ * std::map or std::list, are instead served from free lists carved out of
+ * large slabs. Only the slabs are allocated from, and tracked by, the
+ * Allocator, so its statistics count the slab memory rather than each node.
+ * Larger allocations go to the Allocator directly.
+ *
+ * Copies of a SlabTypedAllocator, including those rebound to another type,
+ * share the slabs, which are returned to the Allocator when the last copy is
+ * destroyed. The slabs are not thread-safe, so copies must not be used from
+ * several threads at once.
+ */
+template <typename T>
+class SlabTypedAllocator {
+ public:
+  typedef T value_type;
+
+  static constexpr std::size_t s_default_slab_size{64 * 1024};
+
+  template <typename U>
+  friend class SlabTypedAllocator;
+
+  /*!
+   * \brief Construct a new SlabTypedAllocator that will allocate its slabs
+   * from allocator.
+   *
+   * \param allocator Allocator to use for allocating memory.
+   * \param slab_size Size of the slabs small objects are carved out of.
+   */
+  explicit SlabTypedAllocator(Allocator allocator, std::size_t slab_size = s_default_slab_size);
+
+  template <typename U>
+  SlabTypedAllocator(const SlabTypedAllocator<U>& other) noexcept;
+
+  /*
+   * \brief Allocate size objects of type T.
+   *
+   * \param size The number of objects to allocate.
+   *
+   * \return Pointer to the start of the allocated memory.
+   */
+  T* allocate(std::size_t size);
+
+  /*!
+   * \brief Deallocate ptr, which holds size objects of type T.
+   *
+   * \param ptr Pointer to deallocate
+   * \param size Number of objects passed to allocate.
+   */
+  void deallocate(T* ptr, std::size_t size);
+
+  template <typename U, typename V>
+  friend bool ::operator==(const SlabTypedAllocator<U>&, const SlabTypedAllocator<V>&);
+
+  template <typename U, typename V>
+  friend bool ::operator!=(const SlabTypedAllocator<U>&, const SlabTypedAllocator<V>&);
+
+ private:
+  std::shared_ptr<detail::SlabCache> m_cache;
+};
+
+} // end of namespace umpire
+
+#include "umpire/SlabTypedAllocator.inl"
+
+#endif // UMPIRE_SlabTypedAllocator_HPP
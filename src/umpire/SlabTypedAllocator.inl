@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_SlabTypedAllocator_INL
+#define UMPIRE_SlabTypedAllocator_INL
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+
+namespace detail {
+
+inline SlabCache::SlabCache(Allocator allocator, std::size_t slab_size) noexcept
+    : m_allocator{allocator}, m_slab_size{(slab_size > s_max_object_size) ? slab_size : s_max_object_size}
+{
+}
+
+inline SlabCache::~SlabCache()
+{
+  for (auto slab : m_slabs) {
+    try {
+      m_allocator.deallocate(slab);
+    } catch (...) {
+      // The Allocator may already be gone at exit
+    }
+  }
+}
+
+inline bool SlabCache::fits(std::size_t bytes) noexcept
+{
+  return (bytes > 0) && (bytes <= s_max_object_size);
+}
+
+inline std::size_t SlabCache::sizeClass(std::size_t bytes) noexcept
+{
+  return (bytes - 1) / s_granularity;
+}
+
+inline void* SlabCache::allocate(std::size_t bytes)
+{
+  const std::size_t size_class{sizeClass(bytes)};
+  FreeObject* object{m_free_lists[size_class]};
+
+  if (object != nullptr) {
+    m_free_lists[size_class] = object->next;
+    return object;
+  }
+
+  const std::size_t object_size{(size_class + 1) * s_granularity};
+  if (m_slab_remaining < object_size) {
+    // Whatever is left of the current slab is too small to bother with
+    m_slab_top = static_cast<char*>(m_allocator.allocate(m_slab_size));
+    m_slab_remaining = m_slab_size;
+    m_slabs.push_back(m_slab_top);
+  }
+
+  void* ptr{m_slab_top};
+  m_slab_top += object_size;
+  m_slab_remaining -= object_size;
+
+  return ptr;
+}
+
+inline void SlabCache::deallocate(void* ptr, std::size_t bytes) noexcept
+{
+  const std::size_t size_class{sizeClass(bytes)};
+  FreeObject* object{static_cast<FreeObject*>(ptr)};
+
+  object->next = m_free_lists[size_class];
+  m_free_lists[size_class] = object;
+}
+
+inline Allocator& SlabCache::getAllocator() noexcept
+{
+  return m_allocator;
+}
+
+} // end of namespace detail
+
+template <typename T>
+SlabTypedAllocator<T>::SlabTypedAllocator(Allocator allocator, std::size_t slab_size)
+    : m_cache{std::make_shared<detail::SlabCache>(allocator, slab_size)}
+{
+}
+
+template <typename T>
+template <typename U>
+SlabTypedAllocator<T>::SlabTypedAllocator(const SlabTypedAllocator<U>& other) noexcept : m_cache(other.m_cache)
+{
+}
+
+template <typename T>
+T* SlabTypedAllocator<T>::allocate(std::size_t size)
+{
+  const std::size_t bytes{sizeof(T) * size};
+
+  if (alignof(T) <= detail::SlabCache::s_granularity && detail::SlabCache::fits(bytes)) {
+    return static_cast<T*>(m_cache->allocate(bytes));
+  }
+
+  return static_cast<T*>(m_cache->getAllocator().allocate(bytes));
+}
+
+template <typename T>
+void SlabTypedAllocator<T>::deallocate(T* ptr, std::size_t size)
+{
+  const std::size_t bytes{sizeof(T) * size};
+
+  if (alignof(T) <= detail::SlabCache::s_granularity && detail::SlabCache::fits(bytes)) {
+    m_cache->deallocate(ptr, bytes);
+  } else {
+    m_cache->getAllocator().deallocate(ptr, bytes);
+  }
+}
+
+} // end of namespace umpire
+
+template <typename U, typename V>
+bool operator==(const umpire::SlabTypedAllocator<U>& lhs, const umpire::SlabTypedAllocator<V>& rhs)
+{
+  return lhs.m_cache == rhs.m_cache;
+}
+
+template <typename U, typename V>
+bool operator!=(const umpire::SlabTypedAllocator<U>& lhs, const umpire::SlabTypedAllocator<V>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+#endif // UMPIRE_SlabTypedAllocator_INL
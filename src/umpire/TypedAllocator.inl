@@ -29,9 +29,9 @@ T* TypedAllocator<T>::allocate(std::size_t size)
 }
 
 template <typename T>
-void TypedAllocator<T>::deallocate(T* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+void TypedAllocator<T>::deallocate(T* ptr, std::size_t size)
 {
-  m_allocator.deallocate(ptr);
+  m_allocator.deallocate(ptr, sizeof(T) * size);
 }
 
 } // end of namespace umpire
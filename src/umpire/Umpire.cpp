@@ -21,6 +21,10 @@
 #include "umpire/resource/MemoryResource.hpp"
 #include "umpire/util/wrap_allocator.hpp"
 
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+#include "umpire/resource/PersistentFileMemoryResource.hpp"
+#endif
+
 #if !defined(_MSC_VER)
 #include <unistd.h>
 #endif
@@ -40,6 +44,12 @@ void print_allocator_records(Allocator allocator, std::ostream& os)
 
   rm.m_allocations.print([strategy](const util::AllocationRecord& rec) { return rec.strategy == strategy; }, ss);
 
+  for (const auto& rec : strategy->getAllocationRecords()) {
+    ss << rec.ptr << " {" << std::endl;
+    util::AllocationMap::printRecord(rec, ss);
+    ss << "}" << std::endl;
+  }
+
   if (!ss.str().empty()) {
     os << "Allocations for " << allocator.getName() << " allocator:" << std::endl << ss.str() << std::endl;
   }
@@ -54,6 +64,9 @@ std::vector<util::AllocationRecord> get_allocator_records(Allocator allocator)
   std::copy_if(rm.m_allocations.begin(), rm.m_allocations.end(), std::back_inserter(recs),
                [strategy](const util::AllocationRecord& rec) { return rec.strategy == strategy; });
 
+  auto owned = strategy->getAllocationRecords();
+  recs.insert(recs.end(), owned.begin(), owned.end());
+
   return recs;
 }
 
@@ -207,6 +220,15 @@ void* find_pointer_from_name(Allocator allocator, const std::string& name)
 {
   void* ptr{nullptr};
 
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+  auto persistent_resource =
+      dynamic_cast<umpire::resource::PersistentFileMemoryResource*>(allocator.getAllocationStrategy());
+
+  if (persistent_resource != nullptr) {
+    return persistent_resource->find_pointer_from_name(name);
+  }
+#endif // defined(UMPIRE_ENABLE_FILE_RESOURCE)
+
 #if defined(UMPIRE_ENABLE_IPC_SHARED_MEMORY)
   auto base_strategy = util::unwrap_allocator<strategy::AllocationStrategy>(allocator);
 
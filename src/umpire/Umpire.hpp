@@ -179,6 +179,8 @@ umpire::MemoryResourceTraits get_default_resource_traits(const std::string& name
 
 /*!
  * \brief Return the pointer of an allocation for the given allocator and name
+ *
+ * The allocator must be a shared memory or persistent file allocator.
  */
 void* find_pointer_from_name(Allocator allocator, const std::string& name);
 
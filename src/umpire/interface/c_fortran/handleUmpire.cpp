@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "handleUmpire.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
+
+namespace {
+
+umpire::ResourceManager& resource_manager()
+{
+  static umpire::ResourceManager& s_resource_manager{umpire::ResourceManager::getInstance()};
+  return s_resource_manager;
+}
+
+//
+// One Allocator per strategy, shared by all of its handles. These are never
+// destroyed, so handles kept in globals stay valid during exit.
+//
+umpire_handle intern(umpire::Allocator allocator)
+{
+  using Allocators = std::unordered_map<umpire::strategy::AllocationStrategy*, std::unique_ptr<umpire::Allocator>>;
+
+  static std::mutex* s_mutex{new std::mutex};
+  static Allocators* s_allocators{new Allocators};
+
+  std::lock_guard<std::mutex> lock(*s_mutex);
+
+  std::unique_ptr<umpire::Allocator>& interned = (*s_allocators)[allocator.getAllocationStrategy()];
+  if (!interned) {
+    interned.reset(new umpire::Allocator{allocator});
+  }
+
+  return reinterpret_cast<umpire_handle>(interned.get());
+}
+
+inline umpire::Allocator& allocator_of(umpire_handle handle)
+{
+  return *reinterpret_cast<umpire::Allocator*>(handle);
+}
+
+} // namespace
+
+extern "C" {
+
+umpire_handle umpire_handle_get_by_name(const char* name)
+{
+  return intern(resource_manager().getAllocator(std::string{name}));
+}
+
+umpire_handle umpire_handle_get_by_name_bufferify(const char* name, int Lname)
+{
+  return intern(resource_manager().getAllocator(std::string(name, Lname)));
+}
+
+umpire_handle umpire_handle_get_by_id(int id)
+{
+  return intern(resource_manager().getAllocator(id));
+}
+
+umpire_handle umpire_handle_get_from_allocator(umpire_allocator* allocator)
+{
+  return intern(*static_cast<umpire::Allocator*>(allocator->addr));
+}
+
+int umpire_handle_get_id(umpire_handle handle)
+{
+  return allocator_of(handle).getId();
+}
+
+void* umpire_handle_allocate(umpire_handle handle, size_t bytes)
+{
+  return allocator_of(handle).allocate(bytes);
+}
+
+void umpire_handle_deallocate(umpire_handle handle, void* ptr)
+{
+  allocator_of(handle).deallocate(ptr);
+}
+
+void umpire_handle_deallocate_sized(umpire_handle handle, void* ptr, size_t bytes)
+{
+  allocator_of(handle).deallocate(ptr, bytes);
+}
+
+void umpire_handle_allocate_bulk(umpire_handle handle, size_t count, size_t bytes, void** ptrs)
+{
+  allocator_of(handle).allocate_bulk(count, bytes, ptrs);
+}
+
+void umpire_handle_deallocate_bulk(umpire_handle handle, void** ptrs, size_t count)
+{
+  allocator_of(handle).deallocate_bulk(ptrs, count);
+}
+
+void umpire_copy(void* dst_ptr, void* src_ptr, size_t bytes)
+{
+  resource_manager().copy(dst_ptr, src_ptr, bytes);
+}
+
+void umpire_memset(void* ptr, int val, size_t bytes)
+{
+  resource_manager().memset(ptr, val, bytes);
+}
+
+} // extern "C"
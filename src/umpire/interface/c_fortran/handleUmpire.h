@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_handleUmpire_H
+#define UMPIRE_handleUmpire_H
+
+/**
+ * \file handleUmpire.h
+ * \brief Lean C interface for allocating through cached allocator handles
+ *
+ * A handle is looked up once, by name or id, and stays valid until the
+ * program exits, so it can be kept in a global or module variable. Handles
+ * are owned by Umpire and are never freed by the caller. Allocating and
+ * deallocating through a handle does no lookups and creates no objects.
+ */
+
+#include "typesUmpire.h"
+#ifdef __cplusplus
+#include <cstddef>
+#else
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct s_umpire_handle* umpire_handle;
+
+umpire_handle umpire_handle_get_by_name(const char* name);
+
+umpire_handle umpire_handle_get_by_name_bufferify(const char* name, int Lname);
+
+umpire_handle umpire_handle_get_by_id(int id);
+
+umpire_handle umpire_handle_get_from_allocator(umpire_allocator* allocator);
+
+int umpire_handle_get_id(umpire_handle handle);
+
+void* umpire_handle_allocate(umpire_handle handle, size_t bytes);
+
+void umpire_handle_deallocate(umpire_handle handle, void* ptr);
+
+/* bytes must be the size that ptr was allocated with */
+void umpire_handle_deallocate_sized(umpire_handle handle, void* ptr, size_t bytes);
+
+/* Allocate count blocks of bytes each into ptrs[0] ... ptrs[count-1] */
+void umpire_handle_allocate_bulk(umpire_handle handle, size_t count, size_t bytes, void** ptrs);
+
+void umpire_handle_deallocate_bulk(umpire_handle handle, void** ptrs, size_t count);
+
+/* A size of 0 copies or sets the whole allocation, as in the ResourceManager */
+void umpire_copy(void* dst_ptr, void* src_ptr, size_t bytes);
+
+void umpire_memset(void* ptr, int val, size_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UMPIRE_handleUmpire_H
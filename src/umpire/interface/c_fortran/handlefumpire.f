@@ -0,0 +1,127 @@
+! Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+! project contributors. See the COPYRIGHT file for details.
+!
+! SPDX-License-Identifier: (MIT)
+!>
+!! \file handlefumpire.f
+!! \brief Fortran bindings for the allocator handles of handleUmpire.h
+!!
+!! A handle is a type(C_PTR) that is looked up once and never freed:
+!!
+!!   type(C_PTR) :: pool
+!!   type(C_PTR) :: data
+!!   pool = umpire_handle_get_by_name("DEVICE_POOL")
+!!   data = umpire_handle_allocate(pool, 1024_C_SIZE_T)
+!!   call umpire_handle_deallocate(pool, data)
+!<
+module umpire_handle_mod
+    use iso_c_binding, only : C_CHAR, C_INT, C_PTR, C_SIZE_T
+    implicit none
+
+    interface
+
+        function c_umpire_handle_get_by_name_bufferify(name, Lname) &
+                result(SHT_rv) &
+                bind(C, name="umpire_handle_get_by_name_bufferify")
+            import :: C_CHAR, C_INT, C_PTR
+            implicit none
+            character(kind=C_CHAR), intent(IN) :: name(*)
+            integer(C_INT), value, intent(IN) :: Lname
+            type(C_PTR) :: SHT_rv
+        end function c_umpire_handle_get_by_name_bufferify
+
+        function umpire_handle_get_by_id(id) &
+                result(SHT_rv) &
+                bind(C, name="umpire_handle_get_by_id")
+            import :: C_INT, C_PTR
+            implicit none
+            integer(C_INT), value, intent(IN) :: id
+            type(C_PTR) :: SHT_rv
+        end function umpire_handle_get_by_id
+
+        function umpire_handle_get_id(handle) &
+                result(SHT_rv) &
+                bind(C, name="umpire_handle_get_id")
+            import :: C_INT, C_PTR
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            integer(C_INT) :: SHT_rv
+        end function umpire_handle_get_id
+
+        function umpire_handle_allocate(handle, bytes) &
+                result(SHT_rv) &
+                bind(C, name="umpire_handle_allocate")
+            import :: C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            integer(C_SIZE_T), value, intent(IN) :: bytes
+            type(C_PTR) :: SHT_rv
+        end function umpire_handle_allocate
+
+        subroutine umpire_handle_deallocate(handle, ptr) &
+                bind(C, name="umpire_handle_deallocate")
+            import :: C_PTR
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            type(C_PTR), value, intent(IN) :: ptr
+        end subroutine umpire_handle_deallocate
+
+        subroutine umpire_handle_deallocate_sized(handle, ptr, bytes) &
+                bind(C, name="umpire_handle_deallocate_sized")
+            import :: C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            type(C_PTR), value, intent(IN) :: ptr
+            integer(C_SIZE_T), value, intent(IN) :: bytes
+        end subroutine umpire_handle_deallocate_sized
+
+        subroutine umpire_handle_allocate_bulk(handle, count, bytes, ptrs) &
+                bind(C, name="umpire_handle_allocate_bulk")
+            import :: C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            integer(C_SIZE_T), value, intent(IN) :: count
+            integer(C_SIZE_T), value, intent(IN) :: bytes
+            type(C_PTR), intent(OUT) :: ptrs(*)
+        end subroutine umpire_handle_allocate_bulk
+
+        subroutine umpire_handle_deallocate_bulk(handle, ptrs, count) &
+                bind(C, name="umpire_handle_deallocate_bulk")
+            import :: C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: handle
+            type(C_PTR), intent(IN) :: ptrs(*)
+            integer(C_SIZE_T), value, intent(IN) :: count
+        end subroutine umpire_handle_deallocate_bulk
+
+        subroutine umpire_copy(dst_ptr, src_ptr, bytes) &
+                bind(C, name="umpire_copy")
+            import :: C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: dst_ptr
+            type(C_PTR), value, intent(IN) :: src_ptr
+            integer(C_SIZE_T), value, intent(IN) :: bytes
+        end subroutine umpire_copy
+
+        subroutine umpire_memset(ptr, val, bytes) &
+                bind(C, name="umpire_memset")
+            import :: C_INT, C_PTR, C_SIZE_T
+            implicit none
+            type(C_PTR), value, intent(IN) :: ptr
+            integer(C_INT), value, intent(IN) :: val
+            integer(C_SIZE_T), value, intent(IN) :: bytes
+        end subroutine umpire_memset
+
+    end interface
+
+contains
+
+    function umpire_handle_get_by_name(name) &
+            result(SHT_rv)
+        character(len=*), intent(IN) :: name
+        type(C_PTR) :: SHT_rv
+        SHT_rv = c_umpire_handle_get_by_name_bufferify(name, &
+            len_trim(name, kind=C_INT))
+    end function umpire_handle_get_by_name
+
+end module umpire_handle_mod
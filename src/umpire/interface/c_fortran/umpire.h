@@ -14,5 +14,6 @@
 #include "umpire/interface/c_fortran/wrapUmpire.h"
 #include "umpire/interface/c_fortran/wrapAllocator.h"
 #include "umpire/interface/c_fortran/wrapResourceManager.h"
+#include "umpire/interface/c_fortran/handleUmpire.h"
 
 #endif // UMPIRE_H_
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/op/FilePrefetchOperation.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace op {
+
+void FilePrefetchOperation::apply(void* src_ptr, util::AllocationRecord* UMPIRE_UNUSED_ARG(allocation),
+                                  int UMPIRE_UNUSED_ARG(value), std::size_t length)
+{
+  if (length == 0) {
+    return;
+  }
+
+  // madvise needs a page aligned address, so widen the range to whole pages
+  const std::uintptr_t pagesize{static_cast<std::uintptr_t>(sysconf(_SC_PAGE_SIZE))};
+  const std::uintptr_t start{reinterpret_cast<std::uintptr_t>(src_ptr)};
+  const std::uintptr_t first_page{start - (start % pagesize)};
+
+  if (::madvise(reinterpret_cast<void*>(first_page), length + (start - first_page), MADV_WILLNEED) != 0) {
+    UMPIRE_ERROR("madvise( src_ptr = " << src_ptr << ", length = " << length
+                                       << ", MADV_WILLNEED ) failed with error: " << strerror(errno));
+  }
+}
+
+camp::resources::EventProxy<camp::resources::Resource> FilePrefetchOperation::apply_async(
+    void* src_ptr, util::AllocationRecord* allocation, int value, std::size_t length, camp::resources::Resource& ctx)
+{
+  // The readahead is already asynchronous
+  apply(src_ptr, allocation, value, length);
+
+  return camp::resources::EventProxy<camp::resources::Resource>{ctx};
+}
+
+} // end of namespace op
+} // end of namespace umpire
@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_FilePrefetchOperation_HPP
+#define UMPIRE_FilePrefetchOperation_HPP
+
+#include "umpire/op/MemoryOperation.hpp"
+
+namespace umpire {
+namespace op {
+
+/*!
+ * \brief Start reading the pages of a file-backed allocation into memory.
+ *
+ * The kernel reads the pages in the background, so the operation returns
+ * without waiting for the I/O and later accesses do not stall on it.
+ */
+class FilePrefetchOperation : public MemoryOperation {
+ public:
+  void apply(void* src_ptr, umpire::util::AllocationRecord* src_allocation, int value, std::size_t length);
+
+  camp::resources::EventProxy<camp::resources::Resource> apply_async(void* src_ptr, util::AllocationRecord* ptr,
+                                                                     int value, std::size_t length,
+                                                                     camp::resources::Resource& ctx);
+};
+
+} // end of namespace op
+} // end of namespace umpire
+
+#endif // UMPIRE_FilePrefetchOperation_HPP
@@ -16,6 +16,10 @@
 #include "umpire/op/NumaMoveOperation.hpp"
 #endif
 
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+#include "umpire/op/FilePrefetchOperation.hpp"
+#endif
+
 #if defined(UMPIRE_ENABLE_CUDA)
 #include "umpire/op/CudaAdviseAccessedByOperation.hpp"
 #include "umpire/op/CudaAdvisePreferredLocationOperation.hpp"
@@ -84,6 +88,12 @@ MemoryOperationRegistry::MemoryOperationRegistry() noexcept
   registerOperation("MOVE", std::make_pair(Platform::cuda, Platform::host), std::make_shared<NumaMoveOperation>());
 #endif
 
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+  // FILE resources have an undefined platform
+  registerOperation("PREFETCH", std::make_pair(Platform::undefined, Platform::undefined),
+                    std::make_shared<FilePrefetchOperation>());
+#endif
+
 #if defined(UMPIRE_ENABLE_CUDA)
   registerOperation("COPY", std::make_pair(Platform::host, Platform::cuda), std::make_shared<CudaCopyToOperation>());
 
@@ -12,8 +12,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/statvfs.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdint>
+
+#include "umpire/util/Macros.hpp"
 #include "umpire/util/Platform.hpp"
 
 #if defined(UMPIRE_ENABLE_CUDA)
@@ -32,18 +37,105 @@ FileMemoryResource::FileMemoryResource(Platform platform, const std::string& nam
 
 FileMemoryResource::~FileMemoryResource()
 {
-  std::vector<void*> leaked_items;
-
-  for (auto const& m : m_size_map) {
-    leaked_items.push_back(m.first);
+  for (auto const& extent : m_extents) {
+    munmap(extent.first, extent.second.size);
   }
 
-  for (auto const& p : leaked_items) {
-    deallocate(p, 0);
+  if (m_fd != -1) {
+    close(m_fd);
+    remove(m_filename.c_str());
   }
 }
 
 void* FileMemoryResource::allocate(std::size_t bytes)
+{
+  if (bytes == 0) {
+    UMPIRE_ERROR("FileMemoryResource cannot allocate 0 bytes");
+  }
+
+  const std::size_t rounded_bytes{((bytes + (s_alignment - 1)) / s_alignment) * s_alignment};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Best fit from the free blocks, growing the file if none is large enough
+  auto block = m_free_sizes.lower_bound(rounded_bytes);
+  if (block == m_free_sizes.end()) {
+    grow(rounded_bytes);
+    block = m_free_sizes.lower_bound(rounded_bytes);
+  }
+
+  char* ptr{block->second};
+  const std::size_t block_size{block->first};
+
+  eraseFree(m_free_blocks.find(ptr));
+  if (block_size > rounded_bytes) {
+    insertFree(ptr + rounded_bytes, block_size - rounded_bytes);
+  }
+
+  m_size_map.insert(ptr, rounded_bytes);
+
+  return ptr;
+}
+
+void FileMemoryResource::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Find information about ptr for deallocation
+  auto iter = m_size_map.find(ptr);
+  if (iter == m_size_map.end()) {
+    UMPIRE_ERROR("FileMemoryResource { " << m_filename << " } does not own pointer " << ptr);
+  }
+
+  const std::size_t bytes{*iter->second};
+  m_size_map.erase(iter);
+
+  freeBlock(static_cast<char*>(ptr), bytes);
+  shrink();
+}
+
+void FileMemoryResource::release()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const std::size_t pagesize{(std::size_t)sysconf(_SC_PAGE_SIZE)};
+
+  for (auto const& block : m_free_blocks) {
+    const std::uintptr_t start{reinterpret_cast<std::uintptr_t>(block.first)};
+    const std::uintptr_t first_page{((start + (pagesize - 1)) / pagesize) * pagesize};
+    const std::uintptr_t last_page{((start + block.second) / pagesize) * pagesize};
+
+    if (last_page > first_page) {
+      auto extent = findExtent(block.first);
+      const std::uintptr_t extent_start{reinterpret_cast<std::uintptr_t>(extent->first)};
+      const off_t offset{extent->second.offset + static_cast<off_t>(first_page - extent_start)};
+
+      // Punching a hole keeps the file size and the mapping; the pages read back as zero
+      if (fallocate(m_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, offset, last_page - first_page) == -1) {
+        UMPIRE_LOG(Warning, "Punching hole at offset " << offset << " in { " << m_filename
+                                                        << " } failed: " << strerror(errno));
+      }
+    }
+  }
+}
+
+std::size_t FileMemoryResource::getCurrentSize() const noexcept
+{
+  return 0;
+}
+
+std::size_t FileMemoryResource::getHighWatermark() const noexcept
+{
+  return 0;
+}
+
+std::size_t FileMemoryResource::getActualSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<std::size_t>(m_file_size);
+}
+
+void FileMemoryResource::openFile()
 {
   // Find output file directory for mmap files
   const char* memory_file_dir{std::getenv("UMPIRE_MEMORY_FILE_DIR")};
@@ -62,58 +154,166 @@ void* FileMemoryResource::allocate(std::size_t bytes)
     UMPIRE_ERROR("Opening File { " << ss.str() << " } Failed: " << strerror(errno));
   }
 
-  // Setting Size Of Map File
-  const std::size_t pagesize{(std::size_t)sysconf(_SC_PAGE_SIZE)};
-  std::size_t rounded_bytes{((bytes + (pagesize - 1)) / pagesize) * pagesize};
+  m_fd = fd;
+  m_filename = ss.str();
+}
 
-  // Truncate file
-  int trun{ftruncate64(fd, rounded_bytes)};
-  if (trun == -1) {
-    int errno_save = errno;
-    remove(ss.str().c_str());
-    UMPIRE_ERROR("truncate64 Of File { " << ss.str() << " } Failed: " << strerror(errno_save));
+void FileMemoryResource::grow(std::size_t bytes)
+{
+  if (m_fd == -1) {
+    openFile();
   }
 
-  // Using mmap
-  void* ptr{mmap(NULL, rounded_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+  // Size of the new extent, scaled to a page length on the system
+  const std::size_t pagesize{(std::size_t)sysconf(_SC_PAGE_SIZE)};
+  const std::size_t extent_size{((std::max(bytes, s_min_extent_size) + (pagesize - 1)) / pagesize) * pagesize};
+  const off_t offset{m_file_size};
+
+  extendFile(offset, extent_size);
+
+  // Map the new extent, asking for it to follow the previous one
+  void* ptr{mmap(m_file_end, extent_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, offset)};
   if (ptr == MAP_FAILED) {
     int errno_save = errno;
-    remove(ss.str().c_str());
-    UMPIRE_ERROR("mmap Of " << rounded_bytes << " To File { " << ss.str() << " } Failed: " << strerror(errno_save));
+    if (ftruncate64(m_fd, offset) == -1) {
+      UMPIRE_LOG(Debug, "Shrinking File { " << m_filename << " } failed: " << strerror(errno));
+    }
+    UMPIRE_ERROR("mmap Of " << extent_size << " To File { " << m_filename << " } Failed: " << strerror(errno_save));
   }
 
-  // Storing Information On File
-  std::pair<const std::string, std::size_t> info{std::make_pair(ss.str(), rounded_bytes)};
-  m_size_map.insert(ptr, info);
+  char* base{static_cast<char*>(ptr)};
 
-  close(fd);
-  return ptr;
+  if (base != nullptr && base == m_file_end) {
+    m_extents[findExtent(m_file_end - 1)->first].size += extent_size;
+  } else {
+    m_extents[base] = Extent{extent_size, offset};
+  }
+
+  m_file_size += extent_size;
+  m_file_end = base + extent_size;
+
+  freeBlock(base, extent_size);
 }
 
-void FileMemoryResource::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+void FileMemoryResource::extendFile(off_t offset, std::size_t bytes)
 {
-  // Find information about ptr for deallocation
-  auto iter = m_size_map.find(ptr);
-  // Unmap File
-  if (munmap(iter->first, iter->second->second) < 0) {
-    UMPIRE_ERROR("munmap Of File { " << iter->second->first.c_str() << " } Failed:" << strerror(errno));
+  //
+  // Reserve the disk blocks of the new extent up front, unless that would use
+  // more than half of the remaining space, in which case the file is only
+  // extended and its blocks are allocated as the pages are first written.
+  //
+  struct statvfs stats;
+  const bool reserve{fstatvfs(m_fd, &stats) == 0 && bytes <= (stats.f_bavail * stats.f_frsize) / 2};
+
+  if (reserve) {
+    if (fallocate(m_fd, 0, offset, bytes) == 0) {
+      return;
+    }
+    UMPIRE_LOG(Debug, "fallocate Of File { " << m_filename << " } Failed: " << strerror(errno));
   }
-  // Remove File
-  if (remove(iter->second->first.c_str()) < 0) {
-    UMPIRE_ERROR("remove Of File { " << iter->second->first.c_str() << " } Failed: " << strerror(errno));
+
+  if (ftruncate64(m_fd, offset + bytes) == -1) {
+    UMPIRE_ERROR("truncate64 Of File { " << m_filename << " } Failed: " << strerror(errno));
   }
-  // Remove Information about file in m_size_map
-  m_size_map.erase(iter->first);
 }
 
-std::size_t FileMemoryResource::getCurrentSize() const noexcept
+std::map<char*, FileMemoryResource::Extent>::const_iterator FileMemoryResource::findExtent(char* ptr) const noexcept
 {
-  return 0;
+  auto extent = m_extents.upper_bound(ptr);
+  if (extent == m_extents.begin()) {
+    return m_extents.end();
+  }
+
+  --extent;
+  return (ptr < extent->first + extent->second.size) ? extent : m_extents.end();
 }
 
-std::size_t FileMemoryResource::getHighWatermark() const noexcept
+void FileMemoryResource::shrink()
 {
-  return 0;
+  auto tail = m_free_blocks.lower_bound(m_file_end);
+  if (tail == m_free_blocks.begin()) {
+    return;
+  }
+
+  --tail;
+  if (tail->first + tail->second != m_file_end) {
+    return;
+  }
+
+  // Keep one minimum extent past the last allocation so that freeing and
+  // allocating it again does not unmap and remap the file every time
+  const std::size_t pagesize{(std::size_t)sysconf(_SC_PAGE_SIZE)};
+  const std::uintptr_t start{reinterpret_cast<std::uintptr_t>(tail->first)};
+  const std::uintptr_t first_page{((start + (pagesize - 1)) / pagesize) * pagesize};
+  char* keep_end{reinterpret_cast<char*>(first_page) + s_min_extent_size};
+
+  if (keep_end >= m_file_end || static_cast<std::size_t>(m_file_end - keep_end) < s_min_extent_size) {
+    return;
+  }
+
+  const std::size_t cut{static_cast<std::size_t>(m_file_end - keep_end)};
+
+  if (munmap(keep_end, cut) == -1) {
+    UMPIRE_LOG(Warning, "munmap Of " << cut << " From File { " << m_filename << " } Failed: " << strerror(errno));
+    return;
+  }
+
+  if (ftruncate64(m_fd, m_file_size - cut) == -1) {
+    UMPIRE_LOG(Warning, "Shrinking File { " << m_filename << " } failed: " << strerror(errno));
+  }
+
+  m_extents[findExtent(m_file_end - 1)->first].size -= cut;
+  m_file_size -= cut;
+  m_file_end = keep_end;
+
+  char* ptr{tail->first};
+  eraseFree(tail);
+  insertFree(ptr, keep_end - ptr);
+}
+
+void FileMemoryResource::insertFree(char* ptr, std::size_t bytes)
+{
+  m_free_blocks.emplace(ptr, bytes);
+  m_free_sizes.emplace(bytes, ptr);
+}
+
+void FileMemoryResource::eraseFree(FreeBlocks::iterator block)
+{
+  auto sizes = m_free_sizes.equal_range(block->second);
+  for (auto iter = sizes.first; iter != sizes.second; ++iter) {
+    if (iter->second == block->first) {
+      m_free_sizes.erase(iter);
+      break;
+    }
+  }
+
+  m_free_blocks.erase(block);
+}
+
+void FileMemoryResource::freeBlock(char* ptr, std::size_t bytes)
+{
+  // Blocks are only merged within an extent
+  auto extent = findExtent(ptr);
+  char* extent_begin{extent->first};
+  char* extent_end{extent->first + extent->second.size};
+
+  auto next = m_free_blocks.find(ptr + bytes);
+  if (next != m_free_blocks.end() && ptr + bytes < extent_end) {
+    bytes += next->second;
+    eraseFree(next);
+  }
+
+  auto prev = m_free_blocks.lower_bound(ptr);
+  if (prev != m_free_blocks.begin()) {
+    --prev;
+    if (prev->first + prev->second == ptr && prev->first >= extent_begin) {
+      ptr = prev->first;
+      bytes += prev->second;
+      eraseFree(prev);
+    }
+  }
+
+  insertFree(ptr, bytes);
 }
 
 bool FileMemoryResource::isPageable() noexcept
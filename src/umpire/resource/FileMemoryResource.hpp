@@ -7,6 +7,10 @@
 #ifndef UMPIRE_FileMemoryResource_HPP
 #define UMPIRE_FileMemoryResource_HPP
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
 #include <utility>
 
 #include "umpire/resource/MemoryResource.hpp"
@@ -19,18 +23,24 @@ namespace resource {
 /*!
  * \brief File Memory allocator
  *
- * This FileMemoryResource uses mmap to create a file mapping in order to use as
- * additional memory. To create this mapping the function needs to take in the
- * size of memory wanted for the allocation. The set location for the allocation
- * by defult is ./ but can be assigned using enviroment variable
+ * This FileMemoryResource maps a single sparse file, created on the first
+ * allocation, and sub-allocates from it. The set location for the file by
+ * defult is ./ but can be assigned using enviroment variable
  * "UMPIRE_MEMORY_FILE_DIR"
  *
- * The return should be a pointer location. The same pointer location can be
- * used for the deallocation. Deallocation uses munmap and removes the file
- * associated with the pointer location.
+ * When no free block is large enough, the file is grown by at least
+ * s_min_extent_size bytes using fallocate and the new extent is mapped with
+ * mmap. Deallocation returns the block to the free list, so allocations in
+ * steady state make no system calls. Once the free space at the end of the
+ * file reaches twice s_min_extent_size, all but s_min_extent_size of it is
+ * unmapped and truncated off the file. The file is removed when the resource
+ * is destroyed.
  */
 class FileMemoryResource : public MemoryResource {
  public:
+  static constexpr std::size_t s_min_extent_size{64 * 1024 * 1024};
+  static constexpr std::size_t s_alignment{64};
+
   /*!
    * \brief Construct a new FileMemoryResource
    *
@@ -42,26 +52,22 @@ class FileMemoryResource : public MemoryResource {
   FileMemoryResource(Platform platform, const std::string& name, int id, MemoryResourceTraits traits);
 
   /*!
-   * \brief Dallocates and removes all files created by the code meant for
-   * allocations
+   * \brief Unmaps and removes the file backing the allocations
    */
   ~FileMemoryResource();
 
   /*!
-   * \brief Creates the allocation of size bytes using mmap
+   * \brief Allocate size bytes from the file
    *
    * Does the allocation as follows:
-   * 1) Find output file directory for mmap files using UMPIRE_MEMORY_FILE_DIR
-   * 2) Create name and create the file index using open
-   * 3) Setting Size Of Map File. Size is scaled to a page length on the system.
-   * 4) Truncate file using ftruncate64
-   * 5) Map file index with mmap
-   * 6) Store information about the allocated file into m_size_map
+   * 1) Round bytes up to s_alignment and take the smallest free block that
+   *    fits, splitting off the remainder
+   * 2) If no block fits, grow the file (created in UMPIRE_MEMORY_FILE_DIR on
+   *    first use) and map the new extent
+   * 3) Store the size of the block in m_size_map
    *
    * \param bytes The requested amount of bytes the user wants to use.
    * Can not be zero or greater than avalable amount of bytes available.
-   * \param UMPIRE_MEMORY_FILE_DIR Used to specify where memory is going
-   * to be allocated from
    *
    * \return void* Since you are only reciving a pointer location of any
    * size non spcaific to a type you will have to cast it to the desired
@@ -70,19 +76,30 @@ class FileMemoryResource : public MemoryResource {
   void* allocate(std::size_t bytes);
 
   /*!
-   * \brief Deallocates file connected to the pointer
+   * \brief Return the block at ptr to the free list
    *
-   * Using m_size_map, the pointer is looked up and the file name and size can
-   * be returned. With this munmap can be called to deallocated the correct
-   * file.
+   * The block is merged with any adjacent free blocks of the same extent.
+   * If that leaves a large free run at the end of the file, the file is
+   * shrunk.
    *
    * \param ptr Pointer location used to look up its information in m_size_map
    */
   void deallocate(void* ptr, std::size_t size);
 
+  /*!
+   * \brief Punch holes in the file under every free block, giving the disk
+   * space back to the file system while keeping the mapping.
+   */
+  void release();
+
   std::size_t getCurrentSize() const noexcept;
   std::size_t getHighWatermark() const noexcept;
 
+  /*!
+   * \brief Return the size of the file backing the allocations
+   */
+  std::size_t getActualSize() const noexcept;
+
   bool isAccessibleFrom(Platform p) noexcept;
 
   Platform getPlatform() noexcept;
@@ -92,12 +109,44 @@ class FileMemoryResource : public MemoryResource {
   Platform m_platform;
 
  private:
+  //
+  // A run of the file that is mapped contiguously in both the address space
+  // and the file.
+  //
+  struct Extent {
+    std::size_t size;
+    off_t offset;
+  };
+
+  using FreeBlocks = std::map<char*, std::size_t>;
+
+  void openFile();
+  void grow(std::size_t bytes);
+  void extendFile(off_t offset, std::size_t bytes);
+
+  std::map<char*, Extent>::const_iterator findExtent(char* ptr) const noexcept;
+
+  void insertFree(char* ptr, std::size_t bytes);
+  void eraseFree(FreeBlocks::iterator block);
+  void freeBlock(char* ptr, std::size_t bytes);
+  void shrink();
+
   /*!
-   * \brief Creates a map of the pointers used in the allocation
-   *
-   * \param std::pair Paring of the file name and the size of the file
+   * \brief Sizes of the blocks currently allocated
    */
-  util::MemoryMap<std::pair<const std::string, std::size_t>> m_size_map;
+  util::MemoryMap<std::size_t> m_size_map;
+
+  std::map<char*, Extent> m_extents;
+
+  FreeBlocks m_free_blocks;
+  std::multimap<std::size_t, char*> m_free_sizes;
+
+  std::string m_filename;
+  int m_fd{-1};
+  off_t m_file_size{0};
+  char* m_file_end{nullptr};
+
+  mutable std::mutex m_mutex;
 
   bool isPageable() noexcept;
 };
@@ -7,6 +7,7 @@
 #include "umpire/resource/FileMemoryResourceFactory.hpp"
 
 #include "umpire/resource/FileMemoryResource.hpp"
+#include "umpire/resource/PersistentFileMemoryResource.hpp"
 #include "umpire/util/Macros.hpp"
 #include "umpire/util/make_unique.hpp"
 
@@ -30,6 +31,10 @@ std::unique_ptr<resource::MemoryResource> FileMemoryResourceFactory::create(cons
 std::unique_ptr<resource::MemoryResource> FileMemoryResourceFactory::create(const std::string& name, int id,
                                                                             MemoryResourceTraits traits)
 {
+  if (name.find("::") != std::string::npos) {
+    return util::make_unique<PersistentFileMemoryResource>(Platform::undefined, name, id, traits);
+  }
+
   return util::make_unique<FileMemoryResource>(Platform::undefined, name, id, traits);
 }
 
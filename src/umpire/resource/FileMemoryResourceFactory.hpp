@@ -14,6 +14,9 @@ namespace resource {
 
 /*!
  * \brief Factory class to construct a MemoryResource.
+ *
+ * Resources named "FILE::<file>" are PersistentFileMemoryResources backed by
+ * <file>, any other name gives a FileMemoryResource.
  */
 class FileMemoryResourceFactory : public MemoryResourceFactory {
   bool isValidMemoryResourceFor(const std::string& name) noexcept final override;
@@ -8,6 +8,7 @@
 
 #include "umpire/config.hpp"
 #include "umpire/resource/HostResourceFactory.hpp"
+#include "umpire/resource/NoOpResourceFactory.hpp"
 #include "umpire/resource/NullMemoryResourceFactory.hpp"
 #include "umpire/util/make_unique.hpp"
 
@@ -15,10 +16,6 @@
 #include "umpire/resource/HostSharedMemoryResourceFactory.hpp"
 #endif
 
-#if defined(UMPIRE_ENABLE_DEVELOPER_BENCHMARKS)
-#include "umpire/resource/NoOpResourceFactory.hpp"
-#endif
-
 #if defined(UMPIRE_ENABLE_FILE_RESOURCE)
 #include "umpire/resource/FileMemoryResourceFactory.hpp"
 #endif
@@ -86,8 +83,8 @@ MemoryResourceRegistry::MemoryResourceRegistry() : m_allocator_factories()
   registerMemoryResource(util::make_unique<resource::HostResourceFactory>());
   m_resource_names.push_back("HOST");
 
-#if defined(UMPIRE_ENABLE_DEVELOPER_BENCHMARKS)
   registerMemoryResource(util::make_unique<resource::NoOpResourceFactory>());
+#if defined(UMPIRE_ENABLE_DEVELOPER_BENCHMARKS)
   m_resource_names.push_back("NO_OP");
 #endif
 
@@ -19,7 +19,10 @@ namespace umpire {
 namespace resource {
 
 NoOpMemoryResource::NoOpMemoryResource(Platform platform, const std::string& name, int id, MemoryResourceTraits traits)
-    : MemoryResource{name, id, traits}, m_platform{platform}
+    : MemoryResource{name, id, traits},
+      m_platform{platform},
+      // Leave 1TB of addresses to each instance
+      m_count{(UINT64_C(1) << 48) + (static_cast<std::size_t>(id) << 40)}
 {
 }
 
@@ -31,22 +34,41 @@ void* NoOpMemoryResource::allocate(std::size_t bytes)
 {
   void* ptr = (void*)m_count;
   m_count += bytes;
+
+  m_current_size += bytes;
+  if (m_current_size > m_high_watermark)
+    m_high_watermark = m_current_size;
+  m_num_allocations++;
+
   return ptr;
 }
 
-void NoOpMemoryResource::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+void NoOpMemoryResource::deallocate(void* ptr, std::size_t size)
 {
   UMPIRE_USE_VAR(ptr);
+
+  m_current_size -= (size < m_current_size) ? size : m_current_size;
+  m_num_deallocations++;
 }
 
 std::size_t NoOpMemoryResource::getCurrentSize() const noexcept
 {
-  return 0;
+  return m_current_size;
 }
 
 std::size_t NoOpMemoryResource::getHighWatermark() const noexcept
 {
-  return 0;
+  return m_high_watermark;
+}
+
+std::size_t NoOpMemoryResource::getNumAllocations() const noexcept
+{
+  return m_num_allocations;
+}
+
+std::size_t NoOpMemoryResource::getNumDeallocations() const noexcept
+{
+  return m_num_deallocations;
 }
 
 bool NoOpMemoryResource::isAccessibleFrom(Platform p) noexcept
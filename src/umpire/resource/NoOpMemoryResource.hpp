@@ -23,6 +23,11 @@ namespace resource {
  * is that more informative measurements and tracking can be done in the
  * benchmark than just focusing on the memory malloc calls.
  *
+ * The sizes passed to allocate and deallocate are added up, so the current
+ * size and high watermark are those that a real resource would have, which
+ * lets the replay tool simulate pools without using any memory. Each
+ * instance hands out addresses from its own range so that they never
+ * overlap.
  */
 class NoOpMemoryResource : public MemoryResource {
  public:
@@ -53,6 +58,16 @@ class NoOpMemoryResource : public MemoryResource {
   std::size_t getCurrentSize() const noexcept;
   std::size_t getHighWatermark() const noexcept;
 
+  /*!
+   * \brief Return the number of calls to allocate so far.
+   */
+  std::size_t getNumAllocations() const noexcept;
+
+  /*!
+   * \brief Return the number of calls to deallocate so far.
+   */
+  std::size_t getNumDeallocations() const noexcept;
+
   bool isAccessibleFrom(Platform p) noexcept;
 
   Platform getPlatform() noexcept;
@@ -61,7 +76,11 @@ class NoOpMemoryResource : public MemoryResource {
   Platform m_platform;
 
  private:
-  std::size_t m_count{(UINT64_C(1) << 48)};
+  std::size_t m_count;
+  std::size_t m_current_size{0};
+  std::size_t m_high_watermark{0};
+  std::size_t m_num_allocations{0};
+  std::size_t m_num_deallocations{0};
 };
 
 } // end of namespace resource
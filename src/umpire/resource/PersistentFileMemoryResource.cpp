@@ -0,0 +1,451 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "umpire/resource/PersistentFileMemoryResource.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/Platform.hpp"
+
+#if defined(UMPIRE_ENABLE_CUDA)
+#include <cuda_runtime_api.h>
+#endif
+
+namespace umpire {
+namespace resource {
+
+namespace {
+
+inline std::size_t round_up(std::size_t bytes, std::size_t alignment)
+{
+  return ((bytes + (alignment - 1)) / alignment) * alignment;
+}
+
+} // end anonymous namespace
+
+PersistentFileMemoryResource::PersistentFileMemoryResource(Platform platform, const std::string& name, int id,
+                                                           MemoryResourceTraits traits)
+    : MemoryResource{name, id, traits}, m_platform{platform}
+{
+  const auto separator = name.find("::");
+  const std::string file{separator == std::string::npos ? std::string{} : name.substr(separator + 2)};
+  if (file.empty()) {
+    UMPIRE_ERROR("PersistentFileMemoryResource name \"" << name << "\" does not name a file, use \"FILE::<file>\"");
+  }
+
+  // Find output file directory for mmap files
+  const char* memory_file_dir{std::getenv("UMPIRE_MEMORY_FILE_DIR")};
+  std::string default_dir = "./";
+  if (memory_file_dir) {
+    default_dir = memory_file_dir;
+  }
+  m_filename = default_dir + file;
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", file=\"" << m_filename << "\""
+                        << ", size=" << traits.size << ")");
+
+  m_fd = open(m_filename.c_str(), O_RDWR | O_CREAT | O_LARGEFILE, S_IRUSR | S_IWUSR);
+  if (m_fd == -1) {
+    UMPIRE_ERROR("Opening File { " << m_filename << " } Failed: " << strerror(errno));
+  }
+
+  try {
+    if (flock(m_fd, LOCK_EX | LOCK_NB) == -1) {
+      UMPIRE_ERROR("Locking File { " << m_filename << " } Failed, it may be in use by another process: "
+                                     << strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(m_fd, &st) == -1) {
+      UMPIRE_ERROR("fstat Of File { " << m_filename << " } Failed: " << strerror(errno));
+    }
+
+    if (st.st_size == 0) {
+      createFile(traits.size == 0 ? s_default_capacity : traits.size);
+    } else {
+      openFile(static_cast<std::size_t>(st.st_size));
+    }
+  } catch (...) {
+    if (m_header) {
+      munmap(m_header, m_size);
+    }
+    close(m_fd);
+    throw;
+  }
+
+  m_header->base_address = reinterpret_cast<std::uintptr_t>(m_header);
+  reclaimUnnamedBlocks();
+}
+
+PersistentFileMemoryResource::~PersistentFileMemoryResource()
+{
+  if (munmap(m_header, m_size) != 0) {
+    UMPIRE_LOG(Error, "Failed to unmap File { " << m_filename << " }: " << strerror(errno));
+  }
+
+  // Closing the file releases the lock
+  close(m_fd);
+}
+
+void* PersistentFileMemoryResource::allocate(std::size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return allocateBlock(std::string{}, bytes);
+}
+
+void* PersistentFileMemoryResource::allocate_named(const std::string& name, std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(name=\"" << name << ", requested_size=" << bytes << ")");
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (!name.empty()) {
+    Block* block{findNamedBlock(name)};
+
+    if (block != nullptr) {
+      const std::size_t available{block->name_offset - block->memory_offset};
+      if (available < bytes) {
+        UMPIRE_ERROR("Allocation \"" << name << "\" in File { " << m_filename << " } holds " << available
+                                     << " bytes, " << bytes << " requested");
+      }
+      return toPointer<void>(block->memory_offset);
+    }
+  }
+
+  return allocateBlock(name, bytes);
+}
+
+void PersistentFileMemoryResource::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const std::uint64_t memory_offset{toOffset(ptr)};
+  Block* prev{nullptr};
+  Block* block{toPointer<Block>(m_header->used_blocks_off)};
+
+  while (block != nullptr && block->memory_offset != memory_offset) {
+    prev = block;
+    block = toPointer<Block>(block->next_block_off);
+  }
+
+  if (block == nullptr) {
+    UMPIRE_ERROR("File { " << m_filename << " } does not own pointer " << ptr);
+  }
+
+  m_header->actual_size -= block->block_size;
+  releaseBlock(block, prev);
+}
+
+std::size_t PersistentFileMemoryResource::getActualSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_header->actual_size;
+}
+
+void* PersistentFileMemoryResource::find_pointer_from_name(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Block* block{findNamedBlock(name)};
+  return block ? toPointer<void>(block->memory_offset) : nullptr;
+}
+
+void PersistentFileMemoryResource::sync()
+{
+  if (msync(m_header, m_size, MS_SYNC) != 0) {
+    UMPIRE_ERROR("msync Of File { " << m_filename << " } Failed: " << strerror(errno));
+  }
+}
+
+const std::string& PersistentFileMemoryResource::getFilename() const noexcept
+{
+  return m_filename;
+}
+
+void PersistentFileMemoryResource::createFile(std::size_t capacity)
+{
+  const std::size_t pagesize{(std::size_t)sysconf(_SC_PAGE_SIZE)};
+  const std::size_t file_size{round_up(capacity, pagesize)};
+  const std::size_t header_size{round_up(sizeof(FileHeader), s_alignment)};
+
+  if (file_size <= header_size + round_up(sizeof(Block), s_alignment)) {
+    UMPIRE_ERROR("Capacity " << capacity << " of File { " << m_filename << " } is too small");
+  }
+
+  // The file is sparse, blocks are allocated as pages are written
+  if (ftruncate64(m_fd, file_size) == -1) {
+    UMPIRE_ERROR("truncate64 Of File { " << m_filename << " } Failed: " << strerror(errno));
+  }
+
+  mapFile(file_size, nullptr);
+
+  m_header->version = s_version;
+  m_header->file_size = file_size;
+  m_header->actual_size = header_size;
+  m_header->used_blocks_off = 0;
+  m_header->free_blocks_off = header_size;
+
+  Block* block{toPointer<Block>(header_size)};
+  block->next_block_off = 0;
+  block->name_offset = 0;
+  block->memory_offset = 0;
+  block->block_size = file_size - header_size;
+
+  // Written last, so that a partially initialized file is never accepted
+  m_header->magic = s_magic;
+}
+
+void PersistentFileMemoryResource::openFile(std::size_t file_size)
+{
+  FileHeader header;
+  if (pread(m_fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+    UMPIRE_ERROR("Reading header of File { " << m_filename << " } Failed");
+  }
+
+  if (header.magic != s_magic || header.version != s_version) {
+    UMPIRE_ERROR("File { " << m_filename << " } is not a persistent Umpire file of version " << s_version);
+  }
+
+  if (header.file_size != file_size) {
+    UMPIRE_ERROR("File { " << m_filename << " } is " << file_size << " bytes, its header records "
+                           << header.file_size);
+  }
+
+  void* hint{reinterpret_cast<void*>(static_cast<std::uintptr_t>(header.base_address))};
+  mapFile(file_size, hint);
+
+  if (m_header != hint) {
+    UMPIRE_LOG(Debug, "File { " << m_filename << " } mapped at " << m_header << " instead of " << hint);
+  }
+}
+
+void PersistentFileMemoryResource::mapFile(std::size_t file_size, void* hint)
+{
+  void* base{mmap(hint, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0)};
+
+  if (base == MAP_FAILED) {
+    UMPIRE_ERROR("mmap Of " << file_size << " To File { " << m_filename << " } Failed: " << strerror(errno));
+  }
+
+  m_header = static_cast<FileHeader*>(base);
+  m_size = file_size;
+}
+
+void* PersistentFileMemoryResource::allocateBlock(const std::string& name, std::size_t bytes)
+{
+  const std::size_t header_size{round_up(sizeof(Block), s_alignment)};
+  const std::size_t mem_size{round_up(bytes, s_alignment)};
+  const std::size_t name_size{round_up(name.length() + 1, s_alignment)};
+  const std::size_t adjusted_size{header_size + mem_size + name_size};
+
+  Block* prev{nullptr};
+  Block* block{findUsableBlock(prev, adjusted_size)};
+
+  if (block == nullptr) {
+    UMPIRE_ERROR("Allocation of " << bytes << " bytes from File { " << m_filename << " } failed, "
+                                  << m_header->actual_size << " of " << m_header->file_size << " bytes in use");
+  }
+
+  splitBlock(block, prev, adjusted_size);
+
+  m_header->actual_size += block->block_size;
+
+  // Push block to the list of used blocks
+  block->next_block_off = m_header->used_blocks_off;
+  m_header->used_blocks_off = toOffset(block);
+
+  block->memory_offset = toOffset(block) + header_size;
+  block->name_offset = block->memory_offset + mem_size;
+
+  char* name_ptr{toPointer<char>(block->name_offset)};
+  name.copy(name_ptr, name.length(), 0);
+  name_ptr[name.length()] = '\0';
+
+  return toPointer<void>(block->memory_offset);
+}
+
+void PersistentFileMemoryResource::reclaimUnnamedBlocks()
+{
+  Block* prev{nullptr};
+  Block* block{toPointer<Block>(m_header->used_blocks_off)};
+
+  while (block != nullptr) {
+    Block* next{toPointer<Block>(block->next_block_off)};
+
+    if (*toPointer<char>(block->name_offset) == '\0') {
+      UMPIRE_LOG(Debug, "Reclaiming unnamed block at offset " << toOffset(block));
+      m_header->actual_size -= block->block_size;
+      releaseBlock(block, prev);
+    } else {
+      prev = block;
+    }
+
+    block = next;
+  }
+}
+
+PersistentFileMemoryResource::Block* PersistentFileMemoryResource::findNamedBlock(const std::string& name) noexcept
+{
+  Block* block{toPointer<Block>(m_header->used_blocks_off)};
+
+  while (block != nullptr) {
+    if (0 == name.compare(toPointer<char>(block->name_offset))) {
+      break;
+    }
+    block = toPointer<Block>(block->next_block_off);
+  }
+
+  return block;
+}
+
+PersistentFileMemoryResource::Block* PersistentFileMemoryResource::findUsableBlock(Block*& prev,
+                                                                                   std::size_t size) noexcept
+{
+  Block* best{nullptr};
+  Block* iter_prev{nullptr};
+  Block* iter{toPointer<Block>(m_header->free_blocks_off)};
+
+  prev = nullptr;
+
+  while (iter != nullptr) {
+    if (iter->block_size >= size && (best == nullptr || iter->block_size < best->block_size)) {
+      best = iter;
+      prev = iter_prev;
+      if (iter->block_size == size)
+        break; // Exact match, won't find a better one, look no further
+    }
+    iter_prev = iter;
+    iter = toPointer<Block>(iter->next_block_off);
+  }
+
+  return best;
+}
+
+void PersistentFileMemoryResource::splitBlock(Block* block, Block* prev, std::size_t size) noexcept
+{
+  const std::size_t remaining{block->block_size - size};
+  std::uint64_t next_off{block->next_block_off};
+
+  if (remaining >= round_up(sizeof(Block), s_alignment) + s_alignment) {
+    Block* rest{toPointer<Block>(toOffset(block) + size)};
+    rest->next_block_off = block->next_block_off;
+    rest->name_offset = 0;
+    rest->memory_offset = 0;
+    rest->block_size = remaining;
+
+    block->block_size = size;
+    next_off = toOffset(rest);
+  }
+
+  // Replace block in the list of free blocks by what is left of it
+  if (prev != nullptr) {
+    prev->next_block_off = next_off;
+  } else {
+    m_header->free_blocks_off = next_off;
+  }
+}
+
+void PersistentFileMemoryResource::releaseBlock(Block* block, Block* prev) noexcept
+{
+  // Remove block from the list of used blocks
+  if (prev != nullptr) {
+    prev->next_block_off = block->next_block_off;
+  } else {
+    m_header->used_blocks_off = block->next_block_off;
+  }
+
+  block->memory_offset = 0;
+  block->name_offset = 0;
+
+  // Insert it in the list of free blocks, which is sorted by offset
+  prev = nullptr;
+  Block* next{toPointer<Block>(m_header->free_blocks_off)};
+
+  while (next != nullptr && next < block) {
+    prev = next;
+    next = toPointer<Block>(next->next_block_off);
+  }
+
+  block->next_block_off = toOffset(next);
+
+  if (prev != nullptr) {
+    prev->next_block_off = toOffset(block);
+  } else {
+    m_header->free_blocks_off = toOffset(block);
+  }
+
+  // Merge with the neighbouring free blocks
+  if (next != nullptr && toOffset(block) + block->block_size == toOffset(next)) {
+    block->block_size += next->block_size;
+    block->next_block_off = next->next_block_off;
+  }
+
+  if (prev != nullptr && toOffset(prev) + prev->block_size == toOffset(block)) {
+    prev->block_size += block->block_size;
+    prev->next_block_off = block->next_block_off;
+  }
+}
+
+template <typename T>
+T* PersistentFileMemoryResource::toPointer(std::uint64_t offset) const noexcept
+{
+  return offset == 0 ? nullptr : reinterpret_cast<T*>(reinterpret_cast<char*>(m_header) + offset);
+}
+
+std::uint64_t PersistentFileMemoryResource::toOffset(const void* ptr) const noexcept
+{
+  const char* base{reinterpret_cast<const char*>(m_header)};
+  return ptr == nullptr ? 0 : static_cast<std::uint64_t>(static_cast<const char*>(ptr) - base);
+}
+
+bool PersistentFileMemoryResource::isPageable() noexcept
+{
+#if defined(UMPIRE_ENABLE_CUDA)
+  int pageableMem = 0;
+  int cdev = 0;
+  cudaGetDevice(&cdev);
+
+  // Device supports coherently accessing pageable memory
+  // without calling cudaHostRegister on it
+  cudaDeviceGetAttribute(&pageableMem, cudaDevAttrPageableMemoryAccess, cdev);
+  if (pageableMem)
+    return true;
+#endif
+  // Note: Regarding omp_target, we pick a default of false here
+  // until we can better determine which device omp_offload is using.
+  return false;
+}
+
+bool PersistentFileMemoryResource::isAccessibleFrom(Platform p) noexcept
+{
+  if (p == Platform::host)
+    return true;
+  else if (p == Platform::cuda) // TODO: Implement omp_target specific test
+    return isPageable();
+  else
+    return false;
+}
+
+Platform PersistentFileMemoryResource::getPlatform() noexcept
+{
+  return m_platform;
+}
+
+} // end of namespace resource
+} // end of namespace umpire
@@ -0,0 +1,147 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_PersistentFileMemoryResource_HPP
+#define UMPIRE_PersistentFileMemoryResource_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "umpire/resource/MemoryResource.hpp"
+#include "umpire/util/Platform.hpp"
+
+namespace umpire {
+namespace resource {
+
+/*!
+ * \brief Memory resource backed by a file that outlives the process.
+ *
+ * A resource named "FILE::<file>" maps the file <file> in the directory
+ * given by the "UMPIRE_MEMORY_FILE_DIR" environment variable (./ by
+ * default). If the file does not exist it is created with a capacity of
+ * traits.size bytes; otherwise the existing file is mapped again, at the
+ * same address when possible.
+ *
+ * The file starts with a header recording its layout, and every allocation
+ * is a block holding its offset, size and name. Allocations made with
+ * allocate_named can therefore be found by name after a restart, using
+ * find_pointer_from_name or by calling allocate_named again. Allocations
+ * without a name are reclaimed when the file is reopened.
+ *
+ * The file is locked while it is mapped, so it can only be used by one
+ * process at a time, and it is not removed when the resource is destroyed.
+ */
+class PersistentFileMemoryResource : public MemoryResource {
+ public:
+  static constexpr std::size_t s_default_capacity{1024ul * 1024ul * 1024ul};
+
+  /*!
+   * \brief Construct a new PersistentFileMemoryResource
+   *
+   * \param platform Platform of this instance of the resource.
+   * \param name Name of this instance of the resource, "FILE::<file>".
+   * \param id Id of this instance of the resource.
+   * \param traits Traits of this instance of the resource. traits.size is the
+   * capacity of a newly created file.
+   */
+  PersistentFileMemoryResource(Platform platform, const std::string& name, int id, MemoryResourceTraits traits);
+
+  /*!
+   * \brief Unmaps the file, keeping it and its allocations on disk
+   */
+  ~PersistentFileMemoryResource();
+
+  void* allocate(std::size_t bytes) override;
+
+  /*!
+   * \brief Allocate bytes with the given name.
+   *
+   * If an allocation with this name already exists in the file, it is
+   * returned instead, as long as it holds at least bytes.
+   */
+  void* allocate_named(const std::string& name, std::size_t bytes) override;
+
+  void deallocate(void* ptr, std::size_t size) override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  bool isAccessibleFrom(Platform p) noexcept override;
+  Platform getPlatform() noexcept override;
+
+  /*!
+   * \brief Return the allocation with the given name, or nullptr.
+   */
+  void* find_pointer_from_name(const std::string& name);
+
+  /*!
+   * \brief Write the contents of the mapping back to the file.
+   *
+   * Returns once the data has reached the storage device, e.g. after
+   * writing a checkpoint.
+   */
+  void sync();
+
+  /*!
+   * \brief Return the path of the file backing this resource.
+   */
+  const std::string& getFilename() const noexcept;
+
+ protected:
+  Platform m_platform;
+
+ private:
+  struct FileHeader {
+    std::uint64_t magic;
+    std::uint64_t version;
+    std::uint64_t file_size;     // Full file size, including this header
+    std::uint64_t actual_size;   // Total current size of allocations+metadata
+    std::uint64_t base_address;  // Address the file was last mapped at
+    std::uint64_t free_blocks_off;
+    std::uint64_t used_blocks_off;
+  };
+
+  struct Block {
+    std::uint64_t next_block_off; // Offset == 0 is same as nullptr
+    std::uint64_t name_offset;
+    std::uint64_t memory_offset;
+    std::uint64_t block_size; // Includes header+memory+name
+  };
+
+  static constexpr std::uint64_t s_magic{0x4650455249504d55}; // "UMPIREPF"
+  static constexpr std::uint64_t s_version{1};
+  static constexpr std::size_t s_alignment{64};
+
+  void createFile(std::size_t capacity);
+  void openFile(std::size_t file_size);
+  void mapFile(std::size_t file_size, void* hint);
+
+  void* allocateBlock(const std::string& name, std::size_t bytes);
+  void reclaimUnnamedBlocks();
+
+  Block* findNamedBlock(const std::string& name) noexcept;
+  Block* findUsableBlock(Block*& prev, std::size_t size) noexcept;
+  void splitBlock(Block* block, Block* prev, std::size_t size) noexcept;
+  void releaseBlock(Block* block, Block* prev) noexcept;
+
+  template <typename T>
+  T* toPointer(std::uint64_t offset) const noexcept;
+  std::uint64_t toOffset(const void* ptr) const noexcept;
+
+  std::string m_filename;
+  int m_fd{-1};
+  std::size_t m_size{0};
+  FileHeader* m_header{nullptr};
+
+  mutable std::mutex m_mutex;
+
+  bool isPageable() noexcept;
+};
+
+} // end of namespace resource
+} // end of namespace umpire
+
+#endif // UMPIRE_PersistentFileMemoryResource_HPP
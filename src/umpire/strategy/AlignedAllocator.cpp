@@ -15,7 +15,8 @@ AlignedAllocator::AlignedAllocator(const std::string& name, int id, Allocator al
     : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "AlignedAllocator"},
       m_allocator(allocator.getAllocationStrategy()),
       m_alignment{alignment},
-      m_mask{static_cast<uintptr_t>(~(m_alignment - 1))}
+      m_mask{static_cast<uintptr_t>(~(m_alignment - 1))},
+      m_aligned_parent{m_allocator->allocatesAligned()}
 {
   if (m_allocator->getPlatform() != Platform::host) {
     UMPIRE_ERROR("Cannot construct AlignedAllocator from non-host Allocator.");
@@ -30,6 +31,10 @@ AlignedAllocator::AlignedAllocator(const std::string& name, int id, Allocator al
 
 void* AlignedAllocator::allocate(std::size_t bytes)
 {
+  if (m_aligned_parent) {
+    return m_allocator->allocate_aligned_internal(bytes, m_alignment);
+  }
+
   std::size_t total_bytes = bytes + sizeof(void*) + m_alignment - 1;
   UMPIRE_LOG(Debug, "requested: " << bytes << " actual: " << bytes + m_alignment - 1);
 
@@ -44,6 +49,10 @@ void* AlignedAllocator::allocate(std::size_t bytes)
 
 void AlignedAllocator::deallocate(void* ptr, std::size_t size)
 {
+  if (m_aligned_parent) {
+    return m_allocator->deallocate_internal(ptr, size);
+  }
+
   uintptr_t aligned_ptr{reinterpret_cast<uintptr_t>(ptr)};
   uintptr_t* header = (uintptr_t*)(aligned_ptr - sizeof(void*));
   void* base_ptr = reinterpret_cast<void*>(*header);
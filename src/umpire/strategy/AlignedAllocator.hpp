@@ -13,6 +13,14 @@
 namespace umpire {
 namespace strategy {
 
+/*!
+ * \brief Allocate memory starting at a multiple of a given alignment.
+ *
+ * If the parent strategy can place allocations at an alignment itself (see
+ * AllocationStrategy::allocatesAligned), as the pools can, requests are passed
+ * on to it unchanged. Otherwise each allocation is padded by the alignment and
+ * a pointer, which holds the address to give back to the parent.
+ */
 class AlignedAllocator : public AllocationStrategy {
  public:
   AlignedAllocator(const std::string& name, int id, Allocator allocator, std::size_t alignment = 16);
@@ -30,6 +38,7 @@ class AlignedAllocator : public AllocationStrategy {
  private:
   std::size_t m_alignment;
   uintptr_t m_mask;
+  bool m_aligned_parent;
 };
 
 } // end of namespace strategy
@@ -0,0 +1,252 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/AllocationMetrics.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+inline std::uint64_t read_cycle_counter() noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+//
+// Only the owning thread writes to a counter, so a plain load and store is
+// enough and avoids a locked read-modify-write.
+//
+inline void add(std::atomic<std::size_t>& counter, std::size_t value) noexcept
+{
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void write_histogram(std::ostream& os, const std::array<std::size_t, AllocationMetrics::s_num_bins>& histogram)
+{
+  os << "[";
+  for (std::size_t i = 0; i < histogram.size(); ++i) {
+    os << (i ? ", " : "") << histogram[i];
+  }
+  os << "]";
+}
+
+void write_prometheus_histogram(std::ostream& os, const std::string& metric, const std::string& labels,
+                                const std::array<std::size_t, AllocationMetrics::s_num_bins>& histogram,
+                                std::size_t sum, std::size_t count)
+{
+  os << "# TYPE " << metric << " histogram\n";
+
+  std::size_t cumulative{0};
+  for (std::size_t i = 0; i < histogram.size() - 1; ++i) {
+    cumulative += histogram[i];
+    os << metric << "_bucket{" << labels << ",le=\"" << (std::size_t{1} << i) << "\"} " << cumulative << "\n";
+  }
+
+  os << metric << "_bucket{" << labels << ",le=\"+Inf\"} " << count << "\n";
+  os << metric << "_sum{" << labels << "} " << sum << "\n";
+  os << metric << "_count{" << labels << "} " << count << "\n";
+}
+
+void write_prometheus_counter(std::ostream& os, const std::string& metric, const std::string& labels,
+                              std::size_t value)
+{
+  os << "# TYPE " << metric << " counter\n";
+  os << metric << "{" << labels << "} " << value << "\n";
+}
+
+} // namespace
+
+std::size_t AllocationMetrics::bin(std::size_t value) noexcept
+{
+  std::size_t index{0};
+  while (index < s_num_bins - 1 && (std::size_t{1} << index) < value) {
+    ++index;
+  }
+  return index;
+}
+
+AllocationMetrics::AllocationMetrics(const std::string& name, int id, Allocator allocator)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "AllocationMetrics"},
+      m_allocator{allocator.getAllocationStrategy()}
+{
+  m_instance_id = ThreadCounters::add(this);
+}
+
+AllocationMetrics::~AllocationMetrics()
+{
+  ThreadCounters::remove(m_instance_id);
+}
+
+void* AllocationMetrics::allocate(std::size_t bytes)
+{
+  Counters* counters{getThreadCounters()};
+
+  const std::uint64_t start{read_cycle_counter()};
+  void* ptr{m_allocator->allocate_internal(bytes)};
+  const std::size_t latency{static_cast<std::size_t>(read_cycle_counter() - start)};
+
+  add(counters->allocations, 1);
+  add(counters->bytes_allocated, bytes);
+  add(counters->total_latency, latency);
+  add(counters->size_histogram[bin(bytes)], 1);
+  add(counters->latency_histogram[bin(latency)], 1);
+
+  return ptr;
+}
+
+void AllocationMetrics::deallocate(void* ptr, std::size_t size)
+{
+  Counters* counters{getThreadCounters()};
+
+  m_allocator->deallocate_internal(ptr, size);
+
+  add(counters->deallocations, 1);
+  add(counters->bytes_deallocated, size);
+}
+
+Platform AllocationMetrics::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits AllocationMetrics::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+AllocationMetrics::Metrics AllocationMetrics::getMetrics() const
+{
+  Metrics metrics;
+
+  std::lock_guard<std::mutex> lock(m_counters_mutex);
+  for (auto& counters : m_counters) {
+    metrics.allocations += counters->allocations.load(std::memory_order_relaxed);
+    metrics.deallocations += counters->deallocations.load(std::memory_order_relaxed);
+    metrics.bytes_allocated += counters->bytes_allocated.load(std::memory_order_relaxed);
+    metrics.bytes_deallocated += counters->bytes_deallocated.load(std::memory_order_relaxed);
+    metrics.total_latency += counters->total_latency.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < s_num_bins; ++i) {
+      metrics.size_histogram[i] += counters->size_histogram[i].load(std::memory_order_relaxed);
+      metrics.latency_histogram[i] += counters->latency_histogram[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  return metrics;
+}
+
+void AllocationMetrics::dump(std::ostream& os, Format format) const
+{
+  const Metrics metrics{getMetrics()};
+
+  if (format == Format::json) {
+    const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+
+    os << "{ \"timestamp\": " << timestamp << ", \"allocator\": \"" << m_name << "\""
+       << ", \"allocations\": " << metrics.allocations << ", \"deallocations\": " << metrics.deallocations
+       << ", \"bytes_allocated\": " << metrics.bytes_allocated
+       << ", \"bytes_deallocated\": " << metrics.bytes_deallocated << ", \"total_latency\": " << metrics.total_latency
+       << ", \"size_histogram\": ";
+    write_histogram(os, metrics.size_histogram);
+    os << ", \"latency_histogram\": ";
+    write_histogram(os, metrics.latency_histogram);
+    os << " }" << std::endl;
+  } else {
+    const std::string labels{"allocator=\"" + m_name + "\""};
+
+    write_prometheus_counter(os, "umpire_allocations_total", labels, metrics.allocations);
+    write_prometheus_counter(os, "umpire_deallocations_total", labels, metrics.deallocations);
+    write_prometheus_counter(os, "umpire_allocated_bytes_total", labels, metrics.bytes_allocated);
+    write_prometheus_counter(os, "umpire_deallocated_bytes_total", labels, metrics.bytes_deallocated);
+    write_prometheus_histogram(os, "umpire_allocation_size_bytes", labels, metrics.size_histogram,
+                               metrics.bytes_allocated, metrics.allocations);
+    write_prometheus_histogram(os, "umpire_allocate_latency_cycles", labels, metrics.latency_histogram,
+                               metrics.total_latency, metrics.allocations);
+    os.flush();
+  }
+}
+
+void AllocationMetrics::dump(const std::string& filename, Format format) const
+{
+  if (format == Format::json) {
+    std::ofstream file{filename, std::ios::app};
+    if (!file) {
+      UMPIRE_ERROR("Opening metrics file { " << filename << " } failed");
+    }
+    dump(file, format);
+  } else {
+    const std::string temporary{filename + ".tmp"};
+    {
+      std::ofstream file{temporary, std::ios::trunc};
+      if (!file) {
+        UMPIRE_ERROR("Opening metrics file { " << temporary << " } failed");
+      }
+      dump(file, format);
+    }
+
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0) {
+      UMPIRE_ERROR("Renaming metrics file { " << temporary << " } to { " << filename << " } failed");
+    }
+  }
+}
+
+AllocationMetrics::Counters* AllocationMetrics::getThreadCounters()
+{
+  Counters* counters{ThreadCounters::find(m_instance_id)};
+
+  if (counters == nullptr) {
+    std::lock_guard<std::mutex> lock(m_counters_mutex);
+
+    for (auto& candidate : m_counters) {
+      bool abandoned{true};
+      if (candidate->abandoned.compare_exchange_strong(abandoned, false, std::memory_order_acquire)) {
+        counters = candidate.get();
+        break;
+      }
+    }
+
+    if (counters == nullptr) {
+      m_counters.emplace_back(new Counters{});
+      counters = m_counters.back().get();
+    }
+
+    ThreadCounters::insert(m_instance_id, counters);
+  }
+
+  return counters;
+}
+
+void AllocationMetrics::retire(Counters* counters)
+{
+  // The counts are kept, and the next new thread carries on from them
+  counters->abandoned.store(true, std::memory_order_release);
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocationMetrics_HPP
+#define UMPIRE_AllocationMetrics_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/util/ThreadRegistry.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief Collect usage metrics for the allocations made through another
+ * allocator.
+ *
+ * Every thread counts its allocations, deallocations and bytes, along with
+ * histograms of allocation sizes and allocate latencies, in counters that
+ * only it writes to, so collecting them takes no locks or atomic
+ * read-modify-write operations. getMetrics adds up the counters of all
+ * threads, and dump writes them out as a JSON line or in the Prometheus text
+ * format.
+ *
+ * Latencies are measured with the time stamp counter on x86-64, in cycles,
+ * and in nanoseconds elsewhere. Deallocated bytes are only counted for
+ * allocators that track their allocations, since the size is not known
+ * otherwise.
+ */
+class AllocationMetrics : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_num_bins{64};
+
+  enum class Format { json, prometheus };
+
+  /*!
+   * \brief Metrics summed over all threads.
+   *
+   * Bin i of each histogram counts the values v with 2^(i-1) < v <= 2^i,
+   * with bin 0 counting values of at most 1.
+   */
+  struct Metrics {
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+    std::size_t bytes_allocated{0};
+    std::size_t bytes_deallocated{0};
+    std::size_t total_latency{0};
+    std::array<std::size_t, s_num_bins> size_histogram{};
+    std::array<std::size_t, s_num_bins> latency_histogram{};
+  };
+
+  /*!
+   * \brief Return the histogram bin holding value.
+   */
+  static std::size_t bin(std::size_t value) noexcept;
+
+  AllocationMetrics(const std::string& name, int id, Allocator allocator);
+
+  ~AllocationMetrics();
+
+  AllocationMetrics(const AllocationMetrics&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  /*!
+   * \brief Return a snapshot of the metrics of all threads.
+   */
+  Metrics getMetrics() const;
+
+  /*!
+   * \brief Write a snapshot of the metrics to os.
+   *
+   * Format::json writes a single line holding a JSON object, while
+   * Format::prometheus writes the metrics in the Prometheus text exposition
+   * format, labelled with the name of this allocator.
+   */
+  void dump(std::ostream& os, Format format) const;
+
+  /*!
+   * \brief Write a snapshot of the metrics to the file filename.
+   *
+   * JSON lines are appended to the file, so calling this periodically builds
+   * up a time series. Prometheus text replaces the contents of the file, by
+   * renaming a temporary file over it, so that a collector reading the file
+   * never sees a partial snapshot.
+   */
+  void dump(const std::string& filename, Format format) const;
+
+ private:
+  //
+  // Counters are only written by the thread that owns them, and are atomic
+  // so that they can be read while that thread is running.
+  //
+  struct Counters {
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> deallocations{0};
+    std::atomic<std::size_t> bytes_allocated{0};
+    std::atomic<std::size_t> bytes_deallocated{0};
+    std::atomic<std::size_t> total_latency{0};
+    std::array<std::atomic<std::size_t>, s_num_bins> size_histogram{};
+    std::array<std::atomic<std::size_t>, s_num_bins> latency_histogram{};
+    std::atomic<bool> abandoned{false};
+  };
+
+  using ThreadCounters = util::ThreadRegistry<AllocationMetrics, Counters>;
+  friend ThreadCounters;
+
+  Counters* getThreadCounters();
+  void retire(Counters* counters);
+
+  strategy::AllocationStrategy* m_allocator;
+
+  std::uint64_t m_instance_id{0};
+
+  mutable std::mutex m_counters_mutex;
+  std::vector<std::unique_ptr<Counters>> m_counters;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_AllocationMetrics_HPP
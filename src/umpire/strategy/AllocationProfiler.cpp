@@ -0,0 +1,309 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/AllocationProfiler.hpp"
+
+#include <fstream>
+#include <functional>
+#include <utility>
+
+#if !defined(_MSC_VER)
+#include <execinfo.h> // for backtrace
+#endif
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+constexpr int s_max_frames{64};
+
+} // namespace
+
+std::size_t AllocationProfiler::StackHash::operator()(const std::vector<void*>& frames) const noexcept
+{
+  std::size_t hash{frames.size()};
+  for (auto frame : frames) {
+    hash ^= std::hash<void*>{}(frame) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+AllocationProfiler::AllocationProfiler(const std::string& name, int id, Allocator allocator,
+                                       std::size_t sample_interval)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "AllocationProfiler"},
+      m_allocator{allocator.getAllocationStrategy()},
+      m_sample_interval{sample_interval}
+{
+  if (m_sample_interval == 0) {
+    UMPIRE_ERROR("AllocationProfiler error: sample_interval must be greater than 0");
+  }
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", sample_interval=" << m_sample_interval << " )");
+
+  m_instance_id = ThreadSamplers::add(this);
+}
+
+AllocationProfiler::~AllocationProfiler()
+{
+  ThreadSamplers::remove(m_instance_id);
+}
+
+void* AllocationProfiler::allocate(std::size_t bytes)
+{
+  void* ptr{m_allocator->allocate_internal(bytes)};
+
+  Sampler* sampler{getThreadSampler()};
+
+  if (bytes < sampler->bytes_until_sample) {
+    sampler->bytes_until_sample -= bytes;
+  } else {
+    sampler->bytes_until_sample = nextSampleDistance(sampler);
+
+    std::vector<void*> frames;
+#if !defined(_MSC_VER)
+    void* callstack[s_max_frames];
+    const int num_frames{::backtrace(callstack, s_max_frames)};
+
+    // Leave out this function
+    if (num_frames > 1) {
+      frames.assign(callstack + 1, callstack + num_frames);
+    }
+#endif
+
+    recordSample(ptr, bytes, std::move(frames));
+  }
+
+  return ptr;
+}
+
+void AllocationProfiler::deallocate(void* ptr, std::size_t size)
+{
+  if (m_num_live_samples.load(std::memory_order_relaxed) > 0) {
+    Sample sample{0, 0};
+    bool sampled{false};
+
+    {
+      Shard& shard{getShard(ptr)};
+      std::lock_guard<std::mutex> lock(shard.mutex);
+
+      auto iter = shard.samples.find(ptr);
+      if (iter != shard.samples.end()) {
+        sample = iter->second;
+        sampled = true;
+        shard.samples.erase(iter);
+      }
+    }
+
+    if (sampled) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      Stack& stack{m_stacks[sample.stack]};
+      savePeak(stack);
+      stack.live_count--;
+      stack.live_bytes -= sample.size;
+      m_live_bytes -= sample.size;
+      m_num_live_samples--;
+    }
+  }
+
+  m_allocator->deallocate_internal(ptr, size);
+}
+
+Platform AllocationProfiler::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits AllocationProfiler::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+void AllocationProfiler::dumpHeapProfile(std::ostream& os) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Stack total;
+  for (const auto& stack : m_stacks) {
+    total.live_count += stack.live_count;
+    total.live_bytes += stack.live_bytes;
+    total.alloc_count += stack.alloc_count;
+    total.alloc_bytes += stack.alloc_bytes;
+  }
+
+  writeProfileHeader(os, total.live_count, total.live_bytes, total.alloc_count, total.alloc_bytes);
+
+  for (const auto& stack : m_stacks) {
+    os << stack.live_count << ": " << stack.live_bytes << " [" << stack.alloc_count << ": " << stack.alloc_bytes
+       << "] @";
+    for (auto frame : stack.frames) {
+      os << " " << frame;
+    }
+    os << "\n";
+  }
+
+  writeMappedLibraries(os);
+}
+
+void AllocationProfiler::dumpPeakHeapProfile(std::ostream& os) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Stacks that have not changed since the peak still hold its totals
+  std::vector<std::pair<std::size_t, std::size_t>> peak;
+  peak.reserve(m_stacks.size());
+  std::size_t peak_count{0};
+  for (const auto& stack : m_stacks) {
+    if (stack.peak_epoch == m_peak_epoch) {
+      peak.emplace_back(stack.peak_count, stack.peak_bytes);
+    } else {
+      peak.emplace_back(stack.live_count, stack.live_bytes);
+    }
+    peak_count += peak.back().first;
+  }
+
+  writeProfileHeader(os, peak_count, m_peak_bytes, peak_count, m_peak_bytes);
+
+  for (std::size_t i = 0; i < peak.size(); ++i) {
+    if (peak[i].first == 0) {
+      continue;
+    }
+
+    os << peak[i].first << ": " << peak[i].second << " [" << peak[i].first << ": " << peak[i].second << "] @";
+    for (auto frame : m_stacks[i].frames) {
+      os << " " << frame;
+    }
+    os << "\n";
+  }
+
+  writeMappedLibraries(os);
+}
+
+std::size_t AllocationProfiler::getNumLiveSamples() const noexcept
+{
+  return m_num_live_samples.load(std::memory_order_relaxed);
+}
+
+AllocationProfiler::Sampler* AllocationProfiler::getThreadSampler()
+{
+  Sampler* sampler{ThreadSamplers::find(m_instance_id)};
+
+  if (sampler == nullptr) {
+    std::lock_guard<std::mutex> lock(m_samplers_mutex);
+
+    for (auto& candidate : m_samplers) {
+      bool abandoned{true};
+      if (candidate->abandoned.compare_exchange_strong(abandoned, false, std::memory_order_acquire)) {
+        sampler = candidate.get();
+        break;
+      }
+    }
+
+    if (sampler == nullptr) {
+      m_samplers.emplace_back(new Sampler{});
+      sampler = m_samplers.back().get();
+
+      std::random_device seed;
+      sampler->generator.seed(seed());
+      sampler->distribution = std::exponential_distribution<double>{1.0 / static_cast<double>(m_sample_interval)};
+      sampler->bytes_until_sample = nextSampleDistance(sampler);
+    }
+
+    ThreadSamplers::insert(m_instance_id, sampler);
+  }
+
+  return sampler;
+}
+
+void AllocationProfiler::retire(Sampler* sampler)
+{
+  sampler->abandoned.store(true, std::memory_order_release);
+}
+
+std::size_t AllocationProfiler::nextSampleDistance(Sampler* sampler)
+{
+  return static_cast<std::size_t>(sampler->distribution(sampler->generator)) + 1;
+}
+
+void AllocationProfiler::recordSample(void* ptr, std::size_t bytes, std::vector<void*>&& frames)
+{
+  std::size_t stack_id;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto iter = m_stack_ids.find(frames);
+    if (iter == m_stack_ids.end()) {
+      stack_id = m_stacks.size();
+      m_stacks.emplace_back();
+      m_stacks.back().frames = frames;
+      // The stack had no live samples at the latest peak
+      m_stacks.back().peak_epoch = m_peak_epoch;
+      m_stack_ids.emplace(std::move(frames), stack_id);
+    } else {
+      stack_id = iter->second;
+    }
+
+    Stack& stack{m_stacks[stack_id]};
+    savePeak(stack);
+    stack.live_count++;
+    stack.live_bytes += bytes;
+    stack.alloc_count++;
+    stack.alloc_bytes += bytes;
+
+    m_live_bytes += bytes;
+    if (m_live_bytes > m_peak_bytes) {
+      m_peak_bytes = m_live_bytes;
+      m_peak_epoch++;
+    }
+
+    m_num_live_samples++;
+  }
+
+  Shard& shard{getShard(ptr)};
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.samples[ptr] = Sample{bytes, stack_id};
+}
+
+void AllocationProfiler::savePeak(Stack& stack) noexcept
+{
+  if (stack.peak_epoch != m_peak_epoch) {
+    stack.peak_count = stack.live_count;
+    stack.peak_bytes = stack.live_bytes;
+    stack.peak_epoch = m_peak_epoch;
+  }
+}
+
+AllocationProfiler::Shard& AllocationProfiler::getShard(void* ptr) noexcept
+{
+  // Allocations are at least 16-byte aligned, so skip the low bits
+  return m_shards[(reinterpret_cast<std::uintptr_t>(ptr) >> 4) % s_num_shards];
+}
+
+void AllocationProfiler::writeProfileHeader(std::ostream& os, std::size_t inuse_count, std::size_t inuse_bytes,
+                                            std::size_t alloc_count, std::size_t alloc_bytes) const
+{
+  os << "heap profile: " << inuse_count << ": " << inuse_bytes << " [" << alloc_count << ": " << alloc_bytes
+     << "] @ heap_v2/" << m_sample_interval << "\n";
+}
+
+void AllocationProfiler::writeMappedLibraries(std::ostream& os) const
+{
+  // pprof uses the mappings to find the binaries to symbolize the stacks with
+  std::ifstream maps{"/proc/self/maps"};
+  if (maps) {
+    os << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+  }
+  os.flush();
+}
+
+} // end of namespace strategy
+} // end namespace umpire
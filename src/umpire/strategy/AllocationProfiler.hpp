@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocationProfiler_HPP
+#define UMPIRE_AllocationProfiler_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/util/ThreadRegistry.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief Sample the call stacks of the allocations made through another
+ * allocator.
+ *
+ * Rather than recording every allocation, the profiler samples one byte in
+ * every sample_interval bytes allocated on average, with the distance
+ * between samples drawn from an exponential distribution, so the allocations
+ * containing a sampled byte form a Poisson sample of the allocated bytes.
+ * Only those allocations pay for capturing their call stack, and each
+ * distinct stack is stored once.
+ *
+ * The profiles are written in the legacy pprof heap profile format, which
+ * pprof scales back up to estimate the unsampled totals:
+ *
+ *   - dumpHeapProfile writes the sampled allocations that are still live,
+ *     along with all sampled allocations made so far.
+ *   - dumpPeakHeapProfile writes the sampled allocations that were live when
+ *     the sampled live bytes were highest.
+ *
+ * Call stacks are not available on Windows.
+ */
+class AllocationProfiler : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_sample_interval{512 * 1024};
+
+  /*!
+   * \brief Construct a new AllocationProfiler.
+   *
+   * \param name Name of this instance of the AllocationProfiler
+   * \param id Unique identifier for this instance
+   * \param allocator Allocator whose allocations are profiled
+   * \param sample_interval Mean number of bytes allocated between samples
+   */
+  AllocationProfiler(const std::string& name, int id, Allocator allocator,
+                     std::size_t sample_interval = s_default_sample_interval);
+
+  ~AllocationProfiler();
+
+  AllocationProfiler(const AllocationProfiler&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  /*!
+   * \brief Write the live and cumulative heap profiles to os.
+   */
+  void dumpHeapProfile(std::ostream& os) const;
+
+  /*!
+   * \brief Write the heap profile at the peak of the sampled live bytes to
+   * os.
+   */
+  void dumpPeakHeapProfile(std::ostream& os) const;
+
+  /*!
+   * \brief Return the number of sampled allocations that are still live.
+   */
+  std::size_t getNumLiveSamples() const noexcept;
+
+ private:
+  struct Sampler {
+    std::minstd_rand generator;
+    std::exponential_distribution<double> distribution;
+    std::size_t bytes_until_sample{0};
+    std::atomic<bool> abandoned{false};
+  };
+
+  struct Stack {
+    std::vector<void*> frames;
+    std::size_t live_count{0};
+    std::size_t live_bytes{0};
+    std::size_t alloc_count{0};
+    std::size_t alloc_bytes{0};
+
+    // Live count and bytes at the peak of epoch peak_epoch. Until the stack
+    // changes after a peak, its live totals are the ones at that peak.
+    std::size_t peak_count{0};
+    std::size_t peak_bytes{0};
+    std::uint64_t peak_epoch{0};
+  };
+
+  struct StackHash {
+    std::size_t operator()(const std::vector<void*>& frames) const noexcept;
+  };
+
+  struct Sample {
+    std::size_t size;
+    std::size_t stack;
+  };
+
+  //
+  // Sampled allocations are spread over several maps so that deallocations
+  // on different threads rarely wait for each other.
+  //
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<void*, Sample> samples;
+  };
+
+  static constexpr std::size_t s_num_shards{16};
+
+  using ThreadSamplers = util::ThreadRegistry<AllocationProfiler, Sampler>;
+  friend ThreadSamplers;
+
+  Sampler* getThreadSampler();
+  void retire(Sampler* sampler);
+
+  std::size_t nextSampleDistance(Sampler* sampler);
+  void savePeak(Stack& stack) noexcept;
+  void recordSample(void* ptr, std::size_t bytes, std::vector<void*>&& frames);
+  Shard& getShard(void* ptr) noexcept;
+
+  void writeProfileHeader(std::ostream& os, std::size_t inuse_count, std::size_t inuse_bytes,
+                          std::size_t alloc_count, std::size_t alloc_bytes) const;
+  void writeMappedLibraries(std::ostream& os) const;
+
+  strategy::AllocationStrategy* m_allocator;
+  const std::size_t m_sample_interval;
+
+  std::uint64_t m_instance_id{0};
+
+  std::mutex m_samplers_mutex;
+  std::vector<std::unique_ptr<Sampler>> m_samplers;
+
+  std::array<Shard, s_num_shards> m_shards;
+  std::atomic<std::size_t> m_num_live_samples{0};
+
+  // Guards the stacks and the live and peak totals
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::vector<void*>, std::size_t, StackHash> m_stack_ids;
+  std::vector<Stack> m_stacks;
+  std::size_t m_live_bytes{0};
+  std::size_t m_peak_bytes{0};
+
+  // Counts the peaks, so that stacks save their totals at the latest one
+  // when they next change rather than all being copied at every peak
+  std::uint64_t m_peak_epoch{0};
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_AllocationProfiler_HPP
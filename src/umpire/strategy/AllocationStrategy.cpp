@@ -6,6 +6,7 @@
 //////////////////////////////////////////////////////////////////////////////
 #include "umpire/strategy/AllocationStrategy.hpp"
 
+#include "umpire/util/AllocationRecord.hpp"
 #include "umpire/util/Macros.hpp"
 
 namespace umpire {
@@ -29,6 +30,30 @@ void* AllocationStrategy::allocate_internal(std::size_t bytes)
   return allocate(bytes);
 }
 
+void* AllocationStrategy::allocate_aligned_internal(std::size_t bytes, std::size_t alignment)
+{
+  void* ptr{allocate_aligned(bytes, alignment)};
+
+  m_current_size += bytes;
+  m_allocation_count++;
+
+  if (m_current_size > m_high_watermark) {
+    m_high_watermark = m_current_size;
+  }
+
+  return ptr;
+}
+
+bool AllocationStrategy::allocatesAligned() const noexcept
+{
+  return false;
+}
+
+void* AllocationStrategy::allocate_aligned(std::size_t UMPIRE_UNUSED_ARG(bytes), std::size_t alignment)
+{
+  UMPIRE_ERROR(m_name << " cannot allocate with an alignment of " << alignment);
+}
+
 void* AllocationStrategy::allocate_named(const std::string& UMPIRE_UNUSED_ARG(name), std::size_t bytes)
 {
   return allocate(bytes);
@@ -42,7 +67,30 @@ void AllocationStrategy::deallocate_internal(void* ptr, std::size_t size)
   deallocate(ptr, size);
 }
 
-const std::string& AllocationStrategy::getName() noexcept
+void AllocationStrategy::allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs)
+{
+  std::size_t allocated{0};
+
+  try {
+    for (; allocated < count; ++allocated) {
+      ptrs[allocated] = allocate(bytes);
+    }
+  } catch (...) {
+    for (std::size_t i = 0; i < allocated; ++i) {
+      deallocate(ptrs[i], bytes);
+    }
+    throw;
+  }
+}
+
+void AllocationStrategy::deallocate_bulk(void* const* ptrs, const std::size_t* sizes, std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    deallocate(ptrs[i], sizes ? sizes[i] : 0);
+  }
+}
+
+const std::string& AllocationStrategy::getName() const noexcept
 {
   return m_name;
 }
@@ -99,6 +147,32 @@ bool AllocationStrategy::tracksMemoryUse() const noexcept
   return false;
 }
 
+bool AllocationStrategy::ownsAllocationRecords() const noexcept
+{
+  return false;
+}
+
+util::AllocationRecord* AllocationStrategy::findAllocationRecord(void* UMPIRE_UNUSED_ARG(ptr)) noexcept
+{
+  return nullptr;
+}
+
+bool AllocationStrategy::insertAllocationRecord(const util::AllocationRecord& UMPIRE_UNUSED_ARG(record))
+{
+  return false;
+}
+
+bool AllocationStrategy::removeAllocationRecord(void* UMPIRE_UNUSED_ARG(ptr),
+                                                util::AllocationRecord* UMPIRE_UNUSED_ARG(record)) noexcept
+{
+  return false;
+}
+
+std::vector<util::AllocationRecord> AllocationStrategy::getAllocationRecords() const
+{
+  return std::vector<util::AllocationRecord>{};
+}
+
 void AllocationStrategy::setTracking(bool tracking) noexcept
 {
   m_tracked = tracking;
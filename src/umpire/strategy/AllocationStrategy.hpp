@@ -11,6 +11,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "umpire/util/MemoryResourceTraits.hpp"
 #include "umpire/util/Platform.hpp"
@@ -20,6 +21,10 @@ namespace umpire {
 class ResourceManager;
 class Allocator;
 
+namespace util {
+struct AllocationRecord;
+}
+
 namespace strategy {
 
 /*!
@@ -49,6 +54,23 @@ class AllocationStrategy {
 
   void deallocate_internal(void* ptr, std::size_t size = 0);
 
+  /*!
+   * \brief Allocate bytes of memory starting at a multiple of alignment.
+   *
+   * Only valid if allocatesAligned() is true. The memory is freed with
+   * deallocate_internal, like any other allocation.
+   *
+   * \param bytes Number of bytes to allocate.
+   * \param alignment Power of 2 that the returned pointer is a multiple of.
+   */
+  void* allocate_aligned_internal(std::size_t bytes, std::size_t alignment);
+
+  /*!
+   * \brief Whether this AllocationStrategy can place allocations at a
+   * requested alignment itself, without padding them.
+   */
+  virtual bool allocatesAligned() const noexcept;
+
   /*!
    * \brief Release any and all unused memory held by this AllocationStrategy
    */
@@ -104,7 +126,7 @@ class AllocationStrategy {
    *
    * \return The name of this AllocationStrategy.
    */
-  const std::string& getName() noexcept;
+  const std::string& getName() const noexcept;
 
   const std::string& getStrategyName() const noexcept;
 
@@ -128,6 +150,47 @@ class AllocationStrategy {
 
   virtual bool tracksMemoryUse() const noexcept;
 
+  /*!
+   * \brief Whether this AllocationStrategy keeps the records of its own
+   * tracked allocations, rather than the ResourceManager.
+   *
+   * Such strategies register the address ranges they allocate from with
+   * ResourceManager::registerOwnedRange, so that the ResourceManager can
+   * find the records of the pointers in those ranges.
+   */
+  virtual bool ownsAllocationRecords() const noexcept;
+
+  /*!
+   * \brief Find the record of the allocation containing ptr.
+   *
+   * \return The record, or nullptr if no allocation recorded by this
+   * AllocationStrategy contains ptr.
+   */
+  virtual util::AllocationRecord* findAllocationRecord(void* ptr) noexcept;
+
+  /*!
+   * \brief Keep the record of an allocation made by this AllocationStrategy.
+   *
+   * \return false if record.ptr is not a live allocation of this
+   * AllocationStrategy, in which case the record must be kept elsewhere.
+   */
+  virtual bool insertAllocationRecord(const util::AllocationRecord& record);
+
+  /*!
+   * \brief Remove the record of the allocation at ptr.
+   *
+   * \param ptr Pointer the allocation was recorded for.
+   * \param record If not nullptr, set to the removed record.
+   *
+   * \return false if this AllocationStrategy holds no record for ptr.
+   */
+  virtual bool removeAllocationRecord(void* ptr, util::AllocationRecord* record) noexcept;
+
+  /*!
+   * \brief Get a copy of all the records kept by this AllocationStrategy.
+   */
+  virtual std::vector<util::AllocationRecord> getAllocationRecords() const;
+
   bool isTracked() const noexcept;
 
   std::size_t m_current_size{0};
@@ -155,12 +218,41 @@ class AllocationStrategy {
   virtual void* allocate(std::size_t bytes) = 0;
   virtual void* allocate_named(const std::string& name, std::size_t bytes);
 
+  /*!
+   * \brief Allocate bytes of memory starting at a multiple of alignment.
+   *
+   * Strategies that override this must also override allocatesAligned.
+   */
+  virtual void* allocate_aligned(std::size_t bytes, std::size_t alignment);
+
   /*!
    * \brief Free the memory at ptr.
    *
    * \param ptr Pointer to free.
    */
   virtual void deallocate(void* ptr, std::size_t size = 0) = 0;
+
+  /*!
+   * \brief Allocate count blocks of bytes each.
+   *
+   * The default allocates each block separately. Strategies that can carve
+   * all the blocks out of a single allocation should override this.
+   *
+   * \param count Number of blocks to allocate.
+   * \param bytes Number of bytes in each block.
+   * \param ptrs Array of count pointers set to the start of each block.
+   */
+  virtual void allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs);
+
+  /*!
+   * \brief Free count blocks of memory.
+   *
+   * \param ptrs Array of count pointers to free.
+   * \param sizes Array of the count sizes of the blocks, or nullptr if the
+   * sizes are not known.
+   * \param count Number of blocks to free.
+   */
+  virtual void deallocate_bulk(void* const* ptrs, const std::size_t* sizes, std::size_t count);
 };
 
 } // end of namespace strategy
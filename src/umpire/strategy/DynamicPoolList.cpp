@@ -34,13 +34,32 @@ void* DynamicPoolList::allocate(size_t bytes)
   return ptr;
 }
 
+void* DynamicPoolList::allocate_aligned(std::size_t bytes, std::size_t alignment)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ", alignment=" << alignment << ")");
+
+  void* ptr = dpa.allocate_aligned(bytes, alignment);
+  return ptr;
+}
+
+bool DynamicPoolList::allocatesAligned() const noexcept
+{
+  return true;
+}
+
 void DynamicPoolList::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 {
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
   dpa.deallocate(ptr);
 
   std::size_t suggested_size{m_should_coalesce(*this)};
-  if (0 != suggested_size) {
+  if (release_free_blocks == suggested_size) {
+    UMPIRE_LOG(Debug, "Heuristic requested release of free blocks for " << this);
+    dpa.release();
+  } else if (decommit_free_blocks == suggested_size) {
+    UMPIRE_LOG(Debug, "Heuristic requested decommit of free blocks for " << this);
+    decommit();
+  } else if (0 != suggested_size) {
     UMPIRE_LOG(Debug,
                "Heuristic returned true, "
                "performing coalesce operation for "
@@ -105,6 +124,11 @@ std::size_t DynamicPoolList::getLargestAvailableBlock() const noexcept
   return LargestAvailableBlock;
 }
 
+util::FreeBlockStatistics DynamicPoolList::getFreeStatistics() const noexcept
+{
+  return dpa.getFreeStatistics();
+}
+
 Platform DynamicPoolList::getPlatform() noexcept
 {
   return m_allocator->getPlatform();
@@ -127,6 +151,20 @@ void DynamicPoolList::coalesce() noexcept
   dpa.coalesce(dpa.getActualSize());
 }
 
+std::size_t DynamicPoolList::decommit(bool lazy) noexcept
+{
+  UMPIRE_LOG(Debug, "(lazy=" << lazy << ")");
+
+  if (m_allocator->getTraits().resource != MemoryResourceTraits::resource_type::host) {
+    UMPIRE_LOG(Debug, "Pool is not in host memory, nothing to decommit");
+    return 0;
+  }
+
+  std::size_t decommitted{dpa.decommit(lazy)};
+  UMPIRE_LOG(Debug, "() returning " << decommitted);
+  return decommitted;
+}
+
 PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::blocks_releasable(std::size_t nblocks)
 {
   return [=](const strategy::DynamicPoolList& pool) {
@@ -134,6 +172,32 @@ PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::blocks_releasable(std::s
   };
 }
 
+PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::idle_releasable(std::chrono::milliseconds idle_time)
+{
+  return idle_releasable_heuristic<DynamicPoolList>(idle_time);
+}
+
+PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::pressure_releasable(std::size_t min_available_bytes,
+                                                                         std::chrono::milliseconds poll_interval)
+{
+  return pressure_releasable_heuristic<DynamicPoolList>(min_available_bytes, poll_interval);
+}
+
+PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::hwm_releasable(std::size_t nsteps)
+{
+  if (nsteps == 0) {
+    UMPIRE_ERROR("Invalid number of steps " << nsteps << ", nsteps must be greater than 0");
+  }
+
+  return hwm_releasable_heuristic<DynamicPoolList>(nsteps);
+}
+
+PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::decommit_releasable(
+    PoolCoalesceHeuristic<DynamicPoolList> should_coalesce)
+{
+  return decommit_heuristic<DynamicPoolList>(should_coalesce);
+}
+
 PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::percent_releasable(int percentage)
 {
   if (percentage < 0 || percentage > 100) {
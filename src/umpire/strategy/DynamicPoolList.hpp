@@ -7,6 +7,7 @@
 #ifndef UMPIRE_DynamicPoolList_HPP
 #define UMPIRE_DynamicPoolList_HPP
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "umpire/strategy/AllocationStrategy.hpp"
 #include "umpire/strategy/DynamicSizePool.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 
 namespace umpire {
 
@@ -37,6 +39,31 @@ class DynamicPoolList : public AllocationStrategy {
   static PoolCoalesceHeuristic<DynamicPoolList> percent_releasable(int percentage);
   static PoolCoalesceHeuristic<DynamicPoolList> blocks_releasable(std::size_t nblocks);
 
+  /*!
+   * \brief Release free blocks after they have been releasable for idle_time.
+   */
+  static PoolCoalesceHeuristic<DynamicPoolList> idle_releasable(std::chrono::milliseconds idle_time);
+
+  /*!
+   * \brief Release free blocks while available host memory (see
+   * util::get_available_host_memory) is below min_available_bytes.
+   */
+  static PoolCoalesceHeuristic<DynamicPoolList> pressure_releasable(
+      std::size_t min_available_bytes, std::chrono::milliseconds poll_interval = std::chrono::milliseconds{100});
+
+  /*!
+   * \brief Coalesce the pool to the high-water mark of in-use bytes over the
+   * last nsteps deallocations.
+   */
+  static PoolCoalesceHeuristic<DynamicPoolList> hwm_releasable(std::size_t nsteps);
+
+  /*!
+   * \brief Decommit free memory (see DynamicPoolList::decommit) instead of
+   * coalescing whenever should_coalesce fires.
+   */
+  static PoolCoalesceHeuristic<DynamicPoolList> decommit_releasable(
+      PoolCoalesceHeuristic<DynamicPoolList> should_coalesce);
+
   static constexpr std::size_t s_default_first_block_size{512 * 1024 * 1024};
   static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
   static constexpr std::size_t s_default_alignment{16};
@@ -63,6 +90,8 @@ class DynamicPoolList : public AllocationStrategy {
 
   void* allocate(size_t bytes) override;
   void deallocate(void* ptr, std::size_t size) override;
+  void* allocate_aligned(std::size_t bytes, std::size_t alignment) override;
+  bool allocatesAligned() const noexcept override;
   void release() override;
 
   std::size_t getReleasableBlocks() const noexcept;
@@ -106,8 +135,30 @@ class DynamicPoolList : public AllocationStrategy {
    */
   std::size_t getLargestAvailableBlock() const noexcept;
 
+  /*!
+   * \brief Return statistics about the free blocks of the pool.
+   *
+   * The statistics are kept up to date as blocks are split and merged, so
+   * this does not walk the pool and can be called as often as needed, e.g.
+   * to sample util::relative_fragmentation.
+   */
+  util::FreeBlockStatistics getFreeStatistics() const noexcept;
+
   void coalesce() noexcept;
 
+  /*!
+   * \brief Return the pages backing free blocks to the operating system.
+   *
+   * The page-aligned interior of every free block is decommitted with
+   * madvise, while the blocks stay in the pool. This is only done for pools
+   * of host memory, and is a no-op otherwise.
+   *
+   * \param lazy Use MADV_FREE instead of MADV_DONTNEED where available.
+   *
+   * \return The number of bytes decommitted.
+   */
+  std::size_t decommit(bool lazy = false) noexcept;
+
  private:
   strategy::AllocationStrategy* m_allocator;
   DynamicSizePool<> dpa;
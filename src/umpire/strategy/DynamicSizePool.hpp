@@ -19,7 +19,9 @@
 #include "umpire/strategy/StdAllocator.hpp"
 #include "umpire/strategy/mixins/AlignedAllocation.hpp"
 #include "umpire/util/Macros.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 #include "umpire/util/memory_sanitizers.hpp"
+#include "umpire/util/system_memory.hpp"
 
 template <class IA = StdAllocator>
 class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
@@ -55,6 +57,26 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
   bool m_is_destructing{false};
 
+  // Running statistics of the free block list. The largest free block is
+  // only found again when the previous largest one is taken.
+  umpire::util::FreeBlockStatistics m_free_stats{};
+  mutable std::size_t m_largest_free{0};
+  mutable bool m_largest_free_stale{false};
+
+  void insertFreeStats(std::size_t size)
+  {
+    m_free_stats.insert(size);
+    if (!m_largest_free_stale && size > m_largest_free)
+      m_largest_free = size;
+  }
+
+  void eraseFreeStats(std::size_t size)
+  {
+    m_free_stats.erase(size);
+    if (size == m_largest_free)
+      m_largest_free_stale = true;
+  }
+
   // Search the list of free blocks and return a usable one if that exists, else
   // NULL
   void findUsableBlock(struct Block *&best, struct Block *&prev, std::size_t size)
@@ -71,6 +93,21 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
     }
   }
 
+  // As findUsableBlock, but for a block with size bytes left after skipping to
+  // the first multiple of alignment in it
+  void findUsableAlignedBlock(struct Block *&best, struct Block *&prev, std::size_t size, std::size_t alignment)
+  {
+    best = prev = NULL;
+    for (struct Block *iter = freeBlocks, *iterPrev = NULL; iter; iter = iter->next) {
+      if (iter->size >= size && aligned_padding(iter->data, alignment) + size <= iter->size &&
+          (!best || iter->size < best->size)) {
+        best = iter;
+        prev = iterPrev;
+      }
+      iterPrev = iter;
+    }
+  }
+
   // Allocate a new block and add it to the list of free blocks
   void allocateBlock(struct Block *&curr, struct Block *&prev, std::size_t size)
   {
@@ -135,6 +172,8 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       prev->next = curr;
     else
       freeBlocks = curr;
+
+    insertFreeStats(size);
   }
 
   void splitBlock(struct Block *&curr, struct Block *&prev, const std::size_t size)
@@ -147,6 +186,7 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
     if (curr->size == size) {
       // Keep it
       next = curr->next;
+      eraseFreeStats(size);
     } else {
       // Split the block
       std::size_t remaining = curr->size - size;
@@ -158,6 +198,8 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       newBlock->blockSize = 0;
       newBlock->next = curr->next;
       next = newBlock;
+      eraseFreeStats(curr->size);
+      insertFreeStats(remaining);
       curr->size = size;
     }
 
@@ -167,6 +209,54 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       freeBlocks = next;
   }
 
+  // Split the free block curr so that it ends at the first multiple of
+  // alignment in it, and make curr and prev the free block that starts there
+  void splitAlignedBlock(struct Block *&curr, struct Block *&prev, std::size_t alignment)
+  {
+    const std::size_t padding{aligned_padding(curr->data, alignment)};
+    if (padding == 0)
+      return;
+
+    struct Block *newBlock = (struct Block *)blockPool.allocate();
+    assert("Failed to allocate block for freeBlock List" && newBlock);
+
+    if (curr->size == curr->blockSize)
+      m_releasable_blocks--;
+
+    newBlock->data = curr->data + padding;
+    newBlock->size = curr->size - padding;
+    newBlock->blockSize = 0;
+    newBlock->next = curr->next;
+
+    eraseFreeStats(curr->size);
+    insertFreeStats(padding);
+    insertFreeStats(newBlock->size);
+
+    curr->size = padding;
+    curr->next = newBlock;
+
+    prev = curr;
+    curr = newBlock;
+  }
+
+  // Move the free block curr to the list of used blocks, keeping size bytes of
+  // it
+  void *useBlock(struct Block *curr, struct Block *prev, std::size_t size, std::size_t bytes)
+  {
+    // Split the free block
+    splitBlock(curr, prev, size);
+
+    // Push node to the list of used nodes
+    curr->next = usedBlocks;
+    usedBlocks = curr;
+
+    m_current_size += size;
+    UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, usedBlocks->data, bytes);
+
+    // Return the new pointer
+    return usedBlocks->data;
+  }
+
   void releaseBlock(struct Block *curr, struct Block *prev)
   {
     assert(curr != NULL);
@@ -186,6 +276,7 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
     // Check if prev and curr can be merged
     if (prev && prev->data + prev->size == curr->data && !curr->blockSize) {
+      eraseFreeStats(prev->size);
       prev->size = prev->size + curr->size;
       blockPool.deallocate(curr); // keep data
       curr = prev;
@@ -197,6 +288,7 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
     // Check if curr and next can be merged
     if (next && curr->data + curr->size == next->data && !next->blockSize) {
+      eraseFreeStats(next->size);
       curr->size = curr->size + next->size;
       curr->next = next->next;
       blockPool.deallocate(next); // keep data
@@ -204,6 +296,8 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       curr->next = next;
     }
 
+    insertFreeStats(curr->size);
+
     if (curr->size == curr->blockSize)
       m_releasable_blocks++;
   }
@@ -226,6 +320,7 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
         m_actual_bytes -= curr->size;
         m_releasable_blocks--;
+        eraseFreeStats(curr->size);
         m_total_blocks--;
 
         freed += curr->size;
@@ -313,18 +408,31 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       allocateBlock(best, prev, rounded_bytes);
     }
 
-    // Split the free block
-    splitBlock(best, prev, rounded_bytes);
+    return useBlock(best, prev, rounded_bytes, bytes);
+  }
 
-    // Push node to the list of used nodes
-    best->next = usedBlocks;
-    usedBlocks = best;
+  // Allocate bytes starting at a multiple of alignment, which must be a power
+  // of two. Freed with deallocate like any other allocation.
+  void *allocate_aligned(std::size_t bytes, std::size_t alignment)
+  {
+    UMPIRE_LOG(Debug, "(bytes=" << bytes << ", alignment=" << alignment << ")");
+    if (alignment <= getAlignment())
+      return allocate(bytes);
 
-    m_current_size += rounded_bytes;
-    UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, usedBlocks->data, bytes);
+    const std::size_t rounded_bytes{aligned_round_up(bytes)};
+    struct Block *best{nullptr}, *prev{nullptr};
 
-    // Return the new pointer
-    return usedBlocks->data;
+    findUsableAlignedBlock(best, prev, rounded_bytes, alignment);
+
+    // Allocate a block if needed. Blocks start at a multiple of the pool's
+    // alignment, so this is enough wherever it starts.
+    if (!best) {
+      allocateBlock(best, prev, rounded_bytes + alignment - getAlignment());
+    }
+
+    splitAlignedBlock(best, prev, alignment);
+
+    return useBlock(best, prev, rounded_bytes, bytes);
   }
 
   void deallocate(void *ptr)
@@ -353,6 +461,17 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
     freeReleasedBlocks();
   }
 
+  // Give the pages backing free blocks back to the OS, keeping the blocks.
+  // Only valid when the pool sits on host memory.
+  std::size_t decommit(bool lazy = false)
+  {
+    UMPIRE_LOG(Debug, "(lazy=" << lazy << ")");
+    std::size_t decommitted{0};
+    for (struct Block *temp = freeBlocks; temp; temp = temp->next)
+      decommitted += umpire::util::decommit_host_memory(temp->data, temp->size, lazy);
+    return decommitted;
+  }
+
   std::size_t getReleasableBlocks() const noexcept
   {
     return m_releasable_blocks;
@@ -395,11 +514,21 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
   std::size_t getLargestAvailableBlock() const
   {
-    std::size_t largest_block{0};
-    for (struct Block *temp = freeBlocks; temp; temp = temp->next)
-      if (temp->size > largest_block)
-        largest_block = temp->size;
-    return largest_block;
+    if (m_largest_free_stale) {
+      m_largest_free = 0;
+      for (struct Block *temp = freeBlocks; temp; temp = temp->next)
+        if (temp->size > m_largest_free)
+          m_largest_free = temp->size;
+      m_largest_free_stale = false;
+    }
+    return m_largest_free;
+  }
+
+  umpire::util::FreeBlockStatistics getFreeStatistics() const
+  {
+    umpire::util::FreeBlockStatistics stats{m_free_stats};
+    stats.largest_free = getLargestAvailableBlock();
+    return stats;
   }
 
   std::size_t getReleasableSize() const
@@ -434,7 +563,7 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
   void coalesce(std::size_t suggested_size)
   {
-    if (getFreeBlocks() > 1) {
+    if (getFreeBlocks() > 1 || (getFreeBlocks() == 1 && suggested_size < getActualSize())) {
       freeReleasedBlocks();
       std::size_t size_post{getActualSize()};
 
@@ -8,6 +8,8 @@
 #include "umpire/strategy/FixedPool.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
@@ -39,7 +41,12 @@ static constexpr std::size_t bits_per_int = sizeof(int) * 8;
 FixedPool::Pool::Pool(AllocationStrategy* allocation_strategy, const std::size_t object_bytes,
                       const std::size_t objects_per_pool, const std::size_t avail_bytes)
     : strategy(allocation_strategy),
-      data(reinterpret_cast<char*>(strategy->allocate_internal(object_bytes * objects_per_pool))),
+      data(reinterpret_cast<char*>(
+          // Start the objects at the largest power of 2 dividing their size,
+          // so that they all share that alignment
+          strategy->allocatesAligned()
+              ? strategy->allocate_aligned_internal(object_bytes * objects_per_pool, object_bytes & (~object_bytes + 1))
+              : strategy->allocate_internal(object_bytes * objects_per_pool))),
       avail(reinterpret_cast<int*>(std::malloc(avail_bytes))),
       num_avail(objects_per_pool)
 {
@@ -132,6 +139,39 @@ void* FixedPool::allocInPool(Pool& p)
   return nullptr;
 }
 
+void* FixedPool::allocAlignedInPool(Pool& p, std::size_t alignment)
+{
+  if (!p.num_avail)
+    return nullptr;
+
+  // Objects are m_obj_bytes apart, so once one is aligned, every step'th one
+  // after it is too
+  const std::size_t step{alignment / std::min(alignment, m_obj_bytes & (~m_obj_bytes + 1))};
+
+  std::size_t index{0};
+  while (index < std::min(step, m_obj_per_pool) &&
+         reinterpret_cast<uintptr_t>(p.data + m_obj_bytes * index) % alignment != 0) {
+    ++index;
+  }
+
+  if (index == step) {
+    return nullptr;
+  }
+
+  for (; index < m_obj_per_pool; index += step) {
+    const std::size_t int_index = index / bits_per_int;
+    const int bit_index = index % bits_per_int;
+    if (p.avail[int_index] & (1 << bit_index)) {
+      // Flip bit 1 -> 0
+      p.avail[int_index] ^= 1 << bit_index;
+      p.num_avail--;
+      return static_cast<void*>(p.data + m_obj_bytes * index);
+    }
+  }
+
+  return nullptr;
+}
+
 void* FixedPool::allocate(std::size_t bytes)
 {
   // Check that bytes passed matches m_obj_bytes or bytes was not passed
@@ -160,6 +200,49 @@ void* FixedPool::allocate(std::size_t bytes)
   return ptr;
 }
 
+void* FixedPool::allocate_aligned(std::size_t bytes, std::size_t alignment)
+{
+  if (bytes > m_obj_bytes) {
+    UMPIRE_ERROR("FixedPool::allocate_aligned(size=" << bytes << "): Larger than object size " << m_obj_bytes);
+  }
+
+  // A sub-pool has an aligned object among every step objects, as long as it
+  // starts at a multiple of their own alignment. Sub-pools from a parent that
+  // does not align them are only known to have the fundamental alignment.
+  const std::size_t obj_alignment{m_obj_bytes & (~m_obj_bytes + 1)};
+  const std::size_t pool_alignment{m_strategy->allocatesAligned() ? obj_alignment : alignof(std::max_align_t)};
+  const std::size_t step{alignment / std::min(alignment, obj_alignment)};
+  if (pool_alignment < std::min(alignment, obj_alignment) || step > m_obj_per_pool) {
+    UMPIRE_ERROR("FixedPool::allocate_aligned(size=" << m_obj_bytes << ", alignment=" << alignment
+                                                     << "): Objects cannot be aligned");
+  }
+
+  void* ptr = nullptr;
+
+  for (auto it = m_pool.rbegin(); it != m_pool.rend() && !ptr; ++it) {
+    ptr = allocAlignedInPool(*it, alignment);
+  }
+
+  if (!ptr) {
+    newPool();
+    ptr = allocAlignedInPool(m_pool.back(), alignment);
+  }
+
+  if (!ptr) {
+    UMPIRE_ERROR("FixedPool::allocate_aligned(size=" << m_obj_bytes << ", alignment=" << alignment
+                                                     << "): No object is aligned");
+  }
+
+  m_current_bytes += m_obj_bytes;
+  m_highwatermark = std::max(m_highwatermark, m_current_bytes);
+  return ptr;
+}
+
+bool FixedPool::allocatesAligned() const noexcept
+{
+  return true;
+}
+
 void FixedPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 {
   for (auto& p : m_pool) {
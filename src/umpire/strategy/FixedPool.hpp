@@ -48,6 +48,17 @@ class FixedPool : public AllocationStrategy {
   void* allocate(std::size_t bytes = 0) override final;
   void deallocate(void* ptr, std::size_t size) override final;
 
+  /*!
+   * \brief Allocate the first free object starting at a multiple of
+   * alignment.
+   *
+   * bytes must be no larger than the object size. If no free object is
+   * aligned, a new sub-pool is added and searched. Throws without adding a
+   * sub-pool if a sub-pool need not hold any object at that alignment.
+   */
+  void* allocate_aligned(std::size_t bytes, std::size_t alignment) override final;
+  bool allocatesAligned() const noexcept override final;
+
   void release() override final;
 
   std::size_t getCurrentSize() const noexcept override final;
@@ -73,6 +84,7 @@ class FixedPool : public AllocationStrategy {
 
   void newPool();
   void* allocInPool(Pool& p);
+  void* allocAlignedInPool(Pool& p, std::size_t alignment);
 
   AllocationStrategy* m_strategy;
   std::size_t m_obj_bytes;
@@ -0,0 +1,431 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/HierarchicalPool.hpp"
+
+#include <algorithm>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/util/Macros.hpp"
+
+#if defined(UMPIRE_ENABLE_NUMA)
+#include "umpire/util/numa.hpp"
+#endif
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+std::size_t num_size_classes(std::size_t min_class_size, std::size_t max_block_size)
+{
+  std::size_t num_classes{1};
+  for (std::size_t size{min_class_size}; size < max_block_size; size <<= 1) {
+    num_classes++;
+  }
+  return num_classes;
+}
+
+std::size_t num_numa_nodes()
+{
+#if defined(UMPIRE_ENABLE_NUMA)
+  try {
+    const auto nodes = numa::get_host_nodes();
+    if (!nodes.empty()) {
+      return static_cast<std::size_t>(*std::max_element(nodes.begin(), nodes.end())) + 1;
+    }
+  } catch (...) {
+    UMPIRE_LOG(Debug, "Could not query NUMA nodes, using a single node pool");
+  }
+#endif
+  return 1;
+}
+
+std::size_t current_numa_node(std::size_t num_nodes)
+{
+#if defined(UMPIRE_ENABLE_NUMA)
+  try {
+    const int node{numa::preferred_node()};
+    if (node >= 0 && static_cast<std::size_t>(node) < num_nodes) {
+      return static_cast<std::size_t>(node);
+    }
+  } catch (...) {
+    UMPIRE_LOG(Debug, "Could not query NUMA node of thread, using node 0");
+  }
+#else
+  UMPIRE_USE_VAR(num_nodes);
+#endif
+  return 0;
+}
+
+} // end anonymous namespace
+
+void HierarchicalPool::FreeList::push(FreeBlock* block) noexcept
+{
+  block->next = head;
+  head = block;
+  count++;
+}
+
+HierarchicalPool::FreeBlock* HierarchicalPool::FreeList::pop() noexcept
+{
+  FreeBlock* block{head};
+  if (block) {
+    head = block->next;
+    count--;
+  }
+  return block;
+}
+
+HierarchicalPool::ThreadCache::ThreadCache(std::size_t n, std::size_t num_classes) : node{n}, free(num_classes)
+{
+}
+
+HierarchicalPool::NodePool::NodePool(std::size_t num_classes) : free(num_classes)
+{
+}
+
+HierarchicalPool::HierarchicalPool(const std::string& name, int id, Allocator allocator,
+                                   const std::size_t max_block_size, const std::size_t max_cached_bytes)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "HierarchicalPool"},
+      m_allocator{allocator.getAllocationStrategy()},
+      m_num_classes{num_size_classes(s_min_class_size, max_block_size)},
+      m_max_cached_bytes{max_cached_bytes}
+{
+  static_assert(sizeof(BlockHeader) <= s_header_size, "BlockHeader does not fit in the block header");
+
+  if (allocator.getPlatform() != Platform::host) {
+    UMPIRE_ERROR("HierarchicalPool error: allocator is not host accessible");
+  }
+
+  const std::size_t num_nodes{num_numa_nodes()};
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    m_nodes.emplace_back(new NodePool{m_num_classes});
+  }
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", max_block_size=" << max_block_size << ", max_cached_bytes=" << max_cached_bytes
+                        << " ) using " << m_num_classes << " size classes and " << num_nodes << " node pools");
+
+  m_instance_id = ThreadCaches::add(this);
+}
+
+HierarchicalPool::~HierarchicalPool()
+{
+  ThreadCaches::remove(m_instance_id);
+
+  for (auto& slab : m_slabs) {
+    try {
+      m_allocator->deallocate_internal(slab.first, slab.second);
+    } catch (...) {
+      //
+      // Ignore error in case the underlying vendor API has already shutdown
+      //
+      UMPIRE_LOG(Error, "Pool is destructing, Exception Ignored");
+    }
+  }
+}
+
+void* HierarchicalPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  const std::size_t size_class{classFor(bytes)};
+
+  if (size_class == m_num_classes) {
+    const std::size_t size{s_header_size + bytes};
+    char* base{nullptr};
+    {
+      std::lock_guard<std::mutex> lock(m_global_mutex);
+      base = static_cast<char*>(m_allocator->allocate_internal(size));
+    }
+    m_actual_bytes += size;
+
+    BlockHeader* header{reinterpret_cast<BlockHeader*>(base)};
+    header->owner = nullptr;
+    header->size_class = size;
+
+    return base + s_header_size;
+  }
+
+  ThreadCache* cache{getThreadCache()};
+  FreeList& list{cache->free[size_class]};
+
+  if (list.head == nullptr) {
+    refill(cache, size_class);
+  }
+
+  FreeBlock* block{list.pop()};
+  BlockHeader* header{reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(block) - s_header_size)};
+  header->owner = cache;
+  header->size_class = size_class;
+
+  return block;
+}
+
+void HierarchicalPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  char* base{static_cast<char*>(ptr) - s_header_size};
+  BlockHeader* header{reinterpret_cast<BlockHeader*>(base)};
+  ThreadCache* owner{header->owner};
+
+  if (owner == nullptr) {
+    const std::size_t size{header->size_class};
+    {
+      std::lock_guard<std::mutex> lock(m_global_mutex);
+      m_allocator->deallocate_internal(base, size);
+    }
+    m_actual_bytes -= size;
+    return;
+  }
+
+  const std::size_t size_class{header->size_class};
+  FreeBlock* block{static_cast<FreeBlock*>(ptr)};
+
+  if (owner == ThreadCaches::find(m_instance_id)) {
+    FreeList& list{owner->free[size_class]};
+    list.push(block);
+
+    const std::size_t max_blocks{maxCachedBlocks(size_class)};
+    if (list.count > max_blocks) {
+      moveToNode(*m_nodes[owner->node], list, size_class, list.count - max_blocks / 2);
+    }
+  } else if (owner->retired.load(std::memory_order_acquire)) {
+    NodePool& node{*m_nodes[owner->node]};
+    std::lock_guard<std::mutex> lock(node.mutex);
+    node.free[size_class].push(block);
+  } else {
+    owner->remote.push(block);
+
+    // The owner may have retired after taking its remote frees, in which case
+    // no one else will
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (owner->retired.load(std::memory_order_relaxed)) {
+      returnToNode(owner, owner->remote.take_all());
+    }
+  }
+}
+
+std::size_t HierarchicalPool::getActualSize() const noexcept
+{
+  return m_actual_bytes;
+}
+
+Platform HierarchicalPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits HierarchicalPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+std::size_t HierarchicalPool::getNumThreadCaches() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_caches_mutex);
+  return m_caches.size();
+}
+
+std::size_t HierarchicalPool::getNumNodes() const noexcept
+{
+  return m_nodes.size();
+}
+
+std::size_t HierarchicalPool::classSize(std::size_t size_class) const noexcept
+{
+  return s_min_class_size << size_class;
+}
+
+std::size_t HierarchicalPool::classFor(std::size_t bytes) const noexcept
+{
+  std::size_t size_class{0};
+  while (size_class < m_num_classes && classSize(size_class) < bytes) {
+    size_class++;
+  }
+  return size_class;
+}
+
+std::size_t HierarchicalPool::maxCachedBlocks(std::size_t size_class) const noexcept
+{
+  return std::max(m_max_cached_bytes / classSize(size_class), std::size_t{1});
+}
+
+HierarchicalPool::ThreadCache* HierarchicalPool::getThreadCache()
+{
+  ThreadCache* cache{ThreadCaches::find(m_instance_id)};
+
+  if (cache == nullptr) {
+    const std::size_t node{current_numa_node(m_nodes.size())};
+    {
+      std::lock_guard<std::mutex> lock(m_caches_mutex);
+
+      // Take over the cache of an exited thread on the same node, so that
+      // threads coming and going do not add caches
+      for (auto& candidate : m_caches) {
+        bool retired{true};
+        if (candidate->node == node &&
+            candidate->retired.compare_exchange_strong(retired, false, std::memory_order_acquire)) {
+          cache = candidate.get();
+          break;
+        }
+      }
+
+      if (cache == nullptr) {
+        m_caches.emplace_back(new ThreadCache{node, m_num_classes});
+        cache = m_caches.back().get();
+      }
+    }
+
+    UMPIRE_LOG(Debug, "Using thread cache " << cache << " on node " << cache->node);
+
+    ThreadCaches::insert(m_instance_id, cache);
+  }
+
+  return cache;
+}
+
+void HierarchicalPool::retire(ThreadCache* cache)
+{
+  UMPIRE_LOG(Debug, "Retiring thread cache " << cache);
+
+  NodePool& node{*m_nodes[cache->node]};
+  for (std::size_t size_class = 0; size_class < m_num_classes; size_class++) {
+    FreeList& list{cache->free[size_class]};
+    moveToNode(node, list, size_class, list.count);
+  }
+
+  // From here on the cache may be taken over by a new thread, and its blocks
+  // are freed to the node pool. Frees pushed before other threads saw that
+  // are moved there too.
+  cache->retired.store(true, std::memory_order_release);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  returnToNode(cache, cache->remote.take_all());
+}
+
+void HierarchicalPool::returnToNode(ThreadCache* cache, FreeBlock* blocks) noexcept
+{
+  if (blocks == nullptr) {
+    return;
+  }
+
+  NodePool& node{*m_nodes[cache->node]};
+  std::lock_guard<std::mutex> lock(node.mutex);
+  while (blocks) {
+    FreeBlock* next{blocks->next};
+    const BlockHeader* header{reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(blocks) - s_header_size)};
+    node.free[header->size_class].push(blocks);
+    blocks = next;
+  }
+}
+
+void HierarchicalPool::drainRemote(ThreadCache* cache, FreeBlock* blocks) noexcept
+{
+  while (blocks) {
+    FreeBlock* next{blocks->next};
+    const BlockHeader* header{reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(blocks) - s_header_size)};
+    cache->free[header->size_class].push(blocks);
+    blocks = next;
+  }
+
+  NodePool& node{*m_nodes[cache->node]};
+  for (std::size_t size_class = 0; size_class < m_num_classes; size_class++) {
+    FreeList& list{cache->free[size_class]};
+    const std::size_t max_blocks{maxCachedBlocks(size_class)};
+    if (list.count > max_blocks) {
+      moveToNode(node, list, size_class, list.count - max_blocks / 2);
+    }
+  }
+}
+
+void HierarchicalPool::moveToNode(NodePool& node, FreeList& from, std::size_t size_class,
+                                  std::size_t nblocks) noexcept
+{
+  std::lock_guard<std::mutex> lock(node.mutex);
+  FreeList& to{node.free[size_class]};
+
+  for (std::size_t i = 0; i < nblocks && from.head; i++) {
+    to.push(from.pop());
+  }
+}
+
+std::size_t HierarchicalPool::takeFromNode(NodePool& node, FreeList& to, std::size_t size_class,
+                                           std::size_t nblocks) noexcept
+{
+  std::lock_guard<std::mutex> lock(node.mutex);
+  FreeList& from{node.free[size_class]};
+
+  std::size_t taken{0};
+  for (; taken < nblocks && from.head; taken++) {
+    to.push(from.pop());
+  }
+  return taken;
+}
+
+void HierarchicalPool::refill(ThreadCache* cache, std::size_t size_class)
+{
+  FreeList& list{cache->free[size_class]};
+  const std::size_t batch{std::max(maxCachedBlocks(size_class) / 2, std::size_t{1})};
+
+  drainRemote(cache, cache->remote.take_all());
+  if (list.head) {
+    return;
+  }
+
+  if (takeFromNode(*m_nodes[cache->node], list, size_class, batch)) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_caches_mutex);
+    for (auto& other : m_caches) {
+      if (other.get() != cache && !other->remote.empty()) {
+        UMPIRE_LOG(Debug, "Stealing remote frees of thread cache " << other.get());
+        drainRemote(cache, other->remote.take_all());
+        if (list.head) {
+          return;
+        }
+      }
+    }
+  }
+
+  for (auto& node : m_nodes) {
+    if (node.get() != m_nodes[cache->node].get() && takeFromNode(*node, list, size_class, batch)) {
+      UMPIRE_LOG(Debug, "Stole " << list.count << " blocks from another node pool");
+      return;
+    }
+  }
+
+  const std::size_t block_size{s_header_size + classSize(size_class)};
+  const std::size_t nblocks{std::max(s_default_slab_size / block_size, std::size_t{1})};
+  const std::size_t slab_size{nblocks * block_size};
+
+  char* slab{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(m_global_mutex);
+    slab = static_cast<char*>(m_allocator->allocate_internal(slab_size));
+    m_slabs.emplace_back(slab, slab_size);
+  }
+  m_actual_bytes += slab_size;
+
+  UMPIRE_LOG(Debug, "Allocated slab of " << nblocks << " blocks of size " << classSize(size_class));
+
+  for (std::size_t i = nblocks; i > 0; i--) {
+    list.push(reinterpret_cast<FreeBlock*>(slab + (i - 1) * block_size + s_header_size));
+  }
+
+  const std::size_t max_blocks{maxCachedBlocks(size_class)};
+  if (list.count > max_blocks) {
+    moveToNode(*m_nodes[cache->node], list, size_class, list.count - max_blocks);
+  }
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,172 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HierarchicalPool_HPP
+#define UMPIRE_HierarchicalPool_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/util/RemoteFreeList.hpp"
+#include "umpire/util/ThreadRegistry.hpp"
+
+namespace umpire {
+
+class Allocator;
+
+namespace strategy {
+
+/*!
+ * \brief Thread-safe pool built as a tree of thread caches, per-NUMA-node
+ * pools and a global pool.
+ *
+ * Allocations up to max_block_size are rounded up to a power-of-two size
+ * class and served from a cache owned by the calling thread without any
+ * locking. Each block remembers the cache it was handed out from: freeing it
+ * on the same thread returns it to that cache, while freeing it on another
+ * thread pushes it onto the owning cache's lock-free remote free list, which
+ * the owner drains on its next allocation.
+ *
+ * A thread cache holds at most max_cached_bytes per size class; surplus
+ * blocks are moved to the pool of the NUMA node the thread runs on. An empty
+ * cache is refilled, in order, from its remote free list, its node pool, the
+ * remote free lists of other threads, the pools of other nodes, and finally
+ * from slabs allocated from the underlying allocator under a global lock.
+ * When a thread exits, the blocks of its cache are handed back to its node
+ * pool, and the cache is taken over by the next new thread on that node.
+ *
+ * Larger allocations are passed straight to the underlying allocator.
+ */
+class HierarchicalPool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_max_block_size{64 * 1024};
+  static constexpr std::size_t s_default_max_cached_bytes{1024 * 1024};
+  static constexpr std::size_t s_default_slab_size{1024 * 1024};
+
+  /*!
+   * \brief Construct a new HierarchicalPool.
+   *
+   * \param name Name of this instance of the HierarchicalPool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that pool uses, must be host
+   * accessible
+   * \param max_block_size Largest allocation served from the pool
+   * \param max_cached_bytes Bytes of each size class a thread cache may hold
+   * before surplus blocks are moved to its node pool
+   */
+  HierarchicalPool(const std::string& name, int id, Allocator allocator,
+                   const std::size_t max_block_size = s_default_max_block_size,
+                   const std::size_t max_cached_bytes = s_default_max_cached_bytes);
+
+  ~HierarchicalPool();
+
+  HierarchicalPool(const HierarchicalPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  /*!
+   * \brief Return the number of thread caches created by the pool. The
+   * caches of threads that have exited are kept for new threads.
+   */
+  std::size_t getNumThreadCaches() const noexcept;
+
+  /*!
+   * \brief Return the number of NUMA nodes the pool has a node pool for.
+   */
+  std::size_t getNumNodes() const noexcept;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct FreeList {
+    FreeBlock* head{nullptr};
+    std::size_t count{0};
+
+    void push(FreeBlock* block) noexcept;
+    FreeBlock* pop() noexcept;
+  };
+
+  struct ThreadCache {
+    ThreadCache(std::size_t node, std::size_t num_classes);
+
+    const std::size_t node;
+    std::vector<FreeList> free;
+    util::RemoteFreeList<FreeBlock> remote;
+    std::atomic<bool> retired{false};
+  };
+
+  struct NodePool {
+    explicit NodePool(std::size_t num_classes);
+
+    std::mutex mutex;
+    std::vector<FreeList> free;
+  };
+
+  //
+  // Every block is preceded by a header. For blocks served from the pool,
+  // owner is the thread cache that handed it out and size_class is its
+  // class. Blocks passed to the underlying allocator have no owner and
+  // size_class holds their size in bytes.
+  //
+  struct BlockHeader {
+    ThreadCache* owner;
+    std::size_t size_class;
+  };
+
+  using ThreadCaches = util::ThreadRegistry<HierarchicalPool, ThreadCache>;
+  friend ThreadCaches;
+
+  static constexpr std::size_t s_header_size{16};
+  static constexpr std::size_t s_min_class_size{16};
+
+  std::size_t classSize(std::size_t size_class) const noexcept;
+  std::size_t classFor(std::size_t bytes) const noexcept;
+  std::size_t maxCachedBlocks(std::size_t size_class) const noexcept;
+
+  ThreadCache* getThreadCache();
+  void retire(ThreadCache* cache);
+
+  void drainRemote(ThreadCache* cache, FreeBlock* blocks) noexcept;
+  void returnToNode(ThreadCache* cache, FreeBlock* blocks) noexcept;
+  void moveToNode(NodePool& node, FreeList& from, std::size_t size_class, std::size_t nblocks) noexcept;
+  std::size_t takeFromNode(NodePool& node, FreeList& to, std::size_t size_class, std::size_t nblocks) noexcept;
+  void refill(ThreadCache* cache, std::size_t size_class);
+
+  strategy::AllocationStrategy* m_allocator;
+
+  std::uint64_t m_instance_id{0};
+  const std::size_t m_num_classes;
+  const std::size_t m_max_cached_bytes;
+
+  std::vector<std::unique_ptr<NodePool>> m_nodes;
+
+  mutable std::mutex m_caches_mutex;
+  std::vector<std::unique_ptr<ThreadCache>> m_caches;
+
+  std::mutex m_global_mutex;
+  std::vector<std::pair<void*, std::size_t>> m_slabs;
+
+  std::atomic<std::size_t> m_actual_bytes{0};
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_HierarchicalPool_HPP
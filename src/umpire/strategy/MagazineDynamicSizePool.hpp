@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _MAGAZINEDYNAMICSIZEPOOL_HPP
+#define _MAGAZINEDYNAMICSIZEPOOL_HPP
+
+#include <cstddef>
+#include <mutex>
+
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/DynamicSizePool.hpp"
+#include "umpire/strategy/StdAllocator.hpp"
+#include "umpire/util/MagazineCache.hpp"
+
+/*!
+ * \brief Thread-safe DynamicSizePool with per-thread magazines for small
+ * sizes.
+ *
+ * As with the quantum caches of vmem, allocations of up to max_cached_size
+ * bytes are rounded up to a multiple of the alignment, and each multiple has
+ * its own magazines. These are served and freed by each thread without
+ * locking, and only reach the DynamicSizePool, under a mutex, when a thread's
+ * magazines and the depot behind them run empty or full. Larger allocations
+ * always go to the DynamicSizePool.
+ *
+ * Objects held in magazines count as allocated in the DynamicSizePool, and
+ * are not coalesced with their neighbours until release is called.
+ */
+template <class IA = StdAllocator>
+class MagazineDynamicSizePool {
+ public:
+  static constexpr std::size_t s_default_max_cached_size{256};
+  static constexpr std::size_t s_default_magazine_size{32};
+  static constexpr std::size_t s_default_max_depot_magazines{8};
+
+  MagazineDynamicSizePool(umpire::strategy::AllocationStrategy *strat,
+                          const std::size_t first_minimum_pool_allocation_size = (16 * 1024),
+                          const std::size_t next_minimum_pool_allocation_size = 256,
+                          const std::size_t alignment = 16,
+                          const std::size_t max_cached_size = s_default_max_cached_size,
+                          const std::size_t magazine_size = s_default_magazine_size,
+                          const std::size_t max_depot_magazines = s_default_max_depot_magazines)
+      : m_pool{strat, first_minimum_pool_allocation_size, next_minimum_pool_allocation_size, alignment},
+        m_alignment{alignment},
+        m_cache{max_cached_size / alignment, magazine_size, max_depot_magazines}
+  {
+  }
+
+  MagazineDynamicSizePool(const MagazineDynamicSizePool &) = delete;
+
+  ~MagazineDynamicSizePool()
+  {
+    m_cache.releaseAll([this](std::size_t, void *ptr) { m_pool.deallocate(ptr); });
+  }
+
+  void *allocate(std::size_t bytes)
+  {
+    const std::size_t size_class{classFor(bytes)};
+
+    if (size_class < m_cache.getNumClasses()) {
+      void *ptr{m_cache.pop(size_class)};
+      if (ptr)
+        return ptr;
+
+      // Allocate the whole class, so the object can be reused for any size in it
+      bytes = classSize(size_class);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.allocate(bytes);
+  }
+
+  /// Free ptr, which must have been allocated with the same bytes.
+  void deallocate(void *ptr, std::size_t bytes)
+  {
+    const std::size_t size_class{classFor(bytes)};
+
+    if (size_class < m_cache.getNumClasses() && m_cache.push(size_class, ptr))
+      return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.deallocate(ptr);
+  }
+
+  /// Free ptr to the pool without caching it, for callers that do not know
+  /// its size.
+  void deallocate(void *ptr)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.deallocate(ptr);
+  }
+
+  /// Return the objects held in the depot to the pool, and release the
+  /// pool's free blocks.
+  void release()
+  {
+    m_cache.release([this](std::size_t, void *ptr) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pool.deallocate(ptr);
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.release();
+  }
+
+  std::size_t getCurrentSize() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getCurrentSize();
+  }
+
+  std::size_t getActualSize() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getActualSize();
+  }
+
+  std::size_t getReleasableBlocks() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getReleasableBlocks();
+  }
+
+  std::size_t getTotalBlocks() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getTotalBlocks();
+  }
+
+ private:
+  // Class i holds sizes of up to (i + 1) alignments. Zero bytes share the
+  // first class.
+  std::size_t classFor(std::size_t bytes) const noexcept
+  {
+    return bytes == 0 ? 0 : (bytes - 1) / m_alignment;
+  }
+
+  std::size_t classSize(std::size_t size_class) const noexcept
+  {
+    return (size_class + 1) * m_alignment;
+  }
+
+  mutable std::mutex m_mutex;
+  DynamicSizePool<IA> m_pool;
+  const std::size_t m_alignment;
+  umpire::util::MagazineCache m_cache;
+};
+
+#endif // _MAGAZINEDYNAMICSIZEPOOL_HPP
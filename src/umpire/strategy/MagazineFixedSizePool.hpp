@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _MAGAZINEFIXEDSIZEPOOL_HPP
+#define _MAGAZINEFIXEDSIZEPOOL_HPP
+
+#include <cstddef>
+#include <mutex>
+
+#include "umpire/strategy/FixedSizePool.hpp"
+#include "umpire/strategy/StdAllocator.hpp"
+#include "umpire/util/MagazineCache.hpp"
+
+/*!
+ * \brief Thread-safe FixedSizePool with per-thread magazines of free objects.
+ *
+ * Each thread allocates from and frees to its own magazines without locking.
+ * Only when those and the depot behind them run empty or full is the
+ * FixedSizePool itself used, under a mutex.
+ */
+template <class T, class MA, class IA = StdAllocator, int NP = (1 << 6)>
+class MagazineFixedSizePool {
+ public:
+  static constexpr std::size_t s_default_magazine_size{64};
+  static constexpr std::size_t s_default_max_depot_magazines{16};
+
+  MagazineFixedSizePool(const std::size_t magazine_size = s_default_magazine_size,
+                        const std::size_t max_depot_magazines = s_default_max_depot_magazines)
+      : m_cache{1, magazine_size, max_depot_magazines}
+  {
+  }
+
+  MagazineFixedSizePool(const MagazineFixedSizePool &) = delete;
+
+  ~MagazineFixedSizePool()
+  {
+    m_cache.releaseAll([this](std::size_t, void *ptr) { m_pool.deallocate(static_cast<T *>(ptr)); });
+  }
+
+  T *allocate()
+  {
+    void *ptr{m_cache.pop(0)};
+    if (ptr)
+      return static_cast<T *>(ptr);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.allocate();
+  }
+
+  void deallocate(T *ptr)
+  {
+    if (m_cache.push(0, ptr))
+      return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.deallocate(ptr);
+  }
+
+  /// Return the objects held in the depot to the pool.
+  void release()
+  {
+    m_cache.release([this](std::size_t, void *ptr) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pool.deallocate(static_cast<T *>(ptr));
+    });
+  }
+
+  /// Return allocated size, including objects held in magazines.
+  std::size_t getCurrentSize()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getCurrentSize();
+  }
+
+  /// Return total size with internal overhead.
+  std::size_t getActualSize()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getActualSize();
+  }
+
+  /// Return the number of pools
+  std::size_t numPools()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.numPools();
+  }
+
+ private:
+  std::mutex m_mutex;
+  FixedSizePool<T, MA, IA, NP> m_pool;
+  umpire::util::MagazineCache m_cache;
+};
+
+#endif // _MAGAZINEFIXEDSIZEPOOL_HPP
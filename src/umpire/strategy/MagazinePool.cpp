@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/MagazinePool.hpp"
+
+#include "umpire/Allocator.hpp"
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+MagazinePool::MagazinePool(const std::string& name, int id, Allocator allocator,
+                           const std::size_t first_minimum_pool_allocation_size,
+                           const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment,
+                           const std::size_t max_cached_size, const std::size_t magazine_size,
+                           const std::size_t max_depot_magazines)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "MagazinePool"},
+      m_allocator{allocator.getAllocationStrategy()},
+      m_pool{m_allocator, first_minimum_pool_allocation_size, next_minimum_pool_allocation_size, alignment,
+             max_cached_size, magazine_size, max_depot_magazines}
+{
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", first_minimum_pool_allocation_size=" << first_minimum_pool_allocation_size
+                        << ", next_minimum_pool_allocation_size=" << next_minimum_pool_allocation_size
+                        << ", alignment=" << alignment << ", max_cached_size=" << max_cached_size
+                        << ", magazine_size=" << magazine_size << ", max_depot_magazines=" << max_depot_magazines
+                        << " )");
+}
+
+void* MagazinePool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+  return m_pool.allocate(bytes);
+}
+
+void MagazinePool::deallocate(void* ptr, std::size_t size)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", size=" << size << ")");
+
+  // Allocations of zero bytes never reach the pool, so zero means the size
+  // is unknown
+  if (size == 0) {
+    m_pool.deallocate(ptr);
+  } else {
+    m_pool.deallocate(ptr, size);
+  }
+}
+
+void MagazinePool::release()
+{
+  UMPIRE_LOG(Debug, "()");
+  m_pool.release();
+}
+
+std::size_t MagazinePool::getActualSize() const noexcept
+{
+  return m_pool.getActualSize();
+}
+
+std::size_t MagazinePool::getReleasableBlocks() const noexcept
+{
+  return m_pool.getReleasableBlocks();
+}
+
+std::size_t MagazinePool::getTotalBlocks() const noexcept
+{
+  return m_pool.getTotalBlocks();
+}
+
+Platform MagazinePool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits MagazinePool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+} // end of namespace strategy
+} // end namespace umpire
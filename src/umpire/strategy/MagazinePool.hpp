@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_MagazinePool_HPP
+#define UMPIRE_MagazinePool_HPP
+
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/MagazineDynamicSizePool.hpp"
+
+namespace umpire {
+
+class Allocator;
+
+namespace strategy {
+
+/*!
+ * \brief Thread-safe dynamic pool with per-thread magazines for small
+ * allocations.
+ *
+ * This AllocationStrategy pools allocations of any size like a
+ * DynamicPoolList, but may be used from several threads at once. Allocations
+ * of up to max_cached_size bytes are rounded up to a multiple of the
+ * alignment, and freed ones are kept in per-thread magazines of their size,
+ * so that most small allocations and frees take no lock. Everything else goes
+ * to the pool under a mutex.
+ *
+ * Frees must pass the allocation's size, as a tracked Allocator does, to be
+ * cached; frees without a size go straight to the pool. Cached allocations
+ * count towards the actual size, not the current size, until release is
+ * called.
+ */
+class MagazinePool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_first_block_size{512 * 1024 * 1024};
+  static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
+  static constexpr std::size_t s_default_alignment{16};
+
+  /*!
+   * \brief Construct a new MagazinePool.
+   *
+   * \param name Name of this instance of the MagazinePool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that pool uses
+   * \param first_minimum_pool_allocation_size Minimum size the pool initially
+   * allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * allocations
+   * \param alignment Number of bytes with which to align allocation sizes
+   * (power-of-2)
+   * \param max_cached_size Largest allocation size kept in magazines
+   * \param magazine_size Number of allocations a magazine holds
+   * \param max_depot_magazines Number of full magazines of each size kept
+   * beyond those held by threads
+   */
+  MagazinePool(const std::string& name, int id, Allocator allocator,
+               const std::size_t first_minimum_pool_allocation_size = s_default_first_block_size,
+               const std::size_t next_minimum_pool_allocation_size = s_default_next_block_size,
+               const std::size_t alignment = s_default_alignment,
+               const std::size_t max_cached_size = MagazineDynamicSizePool<>::s_default_max_cached_size,
+               const std::size_t magazine_size = MagazineDynamicSizePool<>::s_default_magazine_size,
+               const std::size_t max_depot_magazines = MagazineDynamicSizePool<>::s_default_max_depot_magazines);
+
+  MagazinePool(const MagazinePool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  /*!
+   * \brief Return the allocations cached in the depot to the pool, and
+   * release the pool's free blocks.
+   *
+   * Allocations held in the magazines of running threads stay cached.
+   */
+  void release() override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  std::size_t getReleasableBlocks() const noexcept;
+  std::size_t getTotalBlocks() const noexcept;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+ private:
+  strategy::AllocationStrategy* m_allocator;
+  MagazineDynamicSizePool<> m_pool;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_MagazinePool_HPP
@@ -107,6 +107,11 @@ std::size_t MixedPool::getActualSize() const noexcept
   return size;
 }
 
+util::FreeBlockStatistics MixedPool::getFreeStatistics() const noexcept
+{
+  return m_quick_pool.getFreeStatistics();
+}
+
 Platform MixedPool::getPlatform() noexcept
 {
   return m_allocator->getPlatform();
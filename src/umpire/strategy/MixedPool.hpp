@@ -16,6 +16,7 @@
 #include "umpire/strategy/FixedPool.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 
 namespace umpire {
 namespace strategy {
@@ -62,6 +63,14 @@ class MixedPool : public AllocationStrategy {
 
   std::size_t getActualSize() const noexcept override;
 
+  /*!
+   * \brief Return statistics about the free chunks of the internal quick
+   * pool.
+   *
+   * The fixed pools hand out objects of a single size and so are left out.
+   */
+  util::FreeBlockStatistics getFreeStatistics() const noexcept;
+
   Platform getPlatform() noexcept override;
 
   MemoryResourceTraits getTraits() const noexcept override;
@@ -0,0 +1,330 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/OutOfCoreAllocator.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "umpire/resource/MemoryResource.hpp"
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+OutOfCoreAllocator::OutOfCoreAllocator(const std::string& name, int id, Allocator allocator,
+                                       std::size_t host_limit_bytes)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "OutOfCoreAllocator"},
+      m_allocator{allocator.getAllocationStrategy()},
+      m_host_limit_bytes{host_limit_bytes},
+      m_page_size{static_cast<std::size_t>(sysconf(_SC_PAGE_SIZE))}
+{
+  // Allocations are mapped on their own rather than taken from the allocator,
+  // so only the host memory resource itself can stand behind them
+  if (dynamic_cast<resource::MemoryResource*>(m_allocator) == nullptr ||
+      m_allocator->getTraits().resource != MemoryResourceTraits::resource_type::host) {
+    UMPIRE_ERROR("OutOfCoreAllocator error: allocator \"" << allocator.getName()
+                                                           << "\" is not the host memory resource");
+  }
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", host_limit_bytes=" << m_host_limit_bytes << " )");
+
+  // Find output file directory for the spill file
+  const char* memory_file_dir{std::getenv("UMPIRE_MEMORY_FILE_DIR")};
+  std::string default_dir = "./";
+  if (memory_file_dir) {
+    default_dir = memory_file_dir;
+  }
+
+  const std::string filename{default_dir + "umpire_spill_" + std::to_string(getpid()) + "_" + std::to_string(id)};
+
+  m_fd = open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL | O_LARGEFILE, S_IRUSR | S_IWUSR);
+  if (m_fd == -1) {
+    UMPIRE_ERROR("Opening File { " << filename << " } Failed: " << strerror(errno));
+  }
+
+  // The file is only reachable through m_fd, and goes away with it
+  unlink(filename.c_str());
+}
+
+OutOfCoreAllocator::~OutOfCoreAllocator()
+{
+  for (auto& record : m_records) {
+    munmap(record.first, record.second.size);
+  }
+
+  close(m_fd);
+}
+
+void* OutOfCoreAllocator::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  const std::size_t size{((std::max(bytes, std::size_t{1}) + (m_page_size - 1)) / m_page_size) * m_page_size};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // An allocation larger than the host limit goes straight to the file, so
+  // there is no point in spilling others for it
+  if (size <= m_host_limit_bytes) {
+    makeRoom(size, nullptr);
+  }
+
+  Record record{size, false, 0, m_lru.end()};
+  void* ptr{nullptr};
+
+  if (m_resident_bytes + size <= m_host_limit_bytes) {
+    ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+      UMPIRE_ERROR("mmap of " << size << " bytes failed: " << strerror(errno));
+    }
+
+    m_lru.push_front(ptr);
+    record.lru = m_lru.begin();
+    m_resident_bytes += size;
+  } else {
+    // Larger than the host limit, so the allocation starts out in the file
+    record.spilled = true;
+    record.offset = allocateFileRange(size);
+
+    ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, record.offset);
+    if (ptr == MAP_FAILED) {
+      int errno_save = errno;
+      freeFileRange(record.offset, size);
+      UMPIRE_ERROR("mmap of " << size << " bytes of the spill file failed: " << strerror(errno_save));
+    }
+
+    m_spilled_bytes += size;
+  }
+
+  m_records.emplace(ptr, record);
+
+  return ptr;
+}
+
+void OutOfCoreAllocator::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto iter = m_records.find(ptr);
+  if (iter == m_records.end()) {
+    UMPIRE_ERROR("OutOfCoreAllocator " << getName() << " does not own pointer " << ptr);
+  }
+
+  Record& record = iter->second;
+  munmap(ptr, record.size);
+
+  if (record.spilled) {
+    freeFileRange(record.offset, record.size);
+    m_spilled_bytes -= record.size;
+  } else {
+    m_lru.erase(record.lru);
+    m_resident_bytes -= record.size;
+  }
+
+  m_records.erase(iter);
+}
+
+std::size_t OutOfCoreAllocator::getActualSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_resident_bytes + m_spilled_bytes;
+}
+
+Platform OutOfCoreAllocator::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits OutOfCoreAllocator::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+void OutOfCoreAllocator::touch(void* ptr)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto iter = m_records.find(ptr);
+  if (iter == m_records.end()) {
+    UMPIRE_ERROR("OutOfCoreAllocator " << getName() << " does not own pointer " << ptr);
+  }
+
+  Record& record = iter->second;
+
+  if (record.spilled && record.size <= m_host_limit_bytes) {
+    makeRoom(record.size, nullptr);
+    unspill(ptr, record);
+  } else if (!record.spilled) {
+    m_lru.splice(m_lru.begin(), m_lru, record.lru);
+  }
+}
+
+bool OutOfCoreAllocator::isSpilled(void* ptr) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return findRecord(ptr).spilled;
+}
+
+std::size_t OutOfCoreAllocator::getResidentSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_resident_bytes;
+}
+
+std::size_t OutOfCoreAllocator::getSpilledSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_spilled_bytes;
+}
+
+void OutOfCoreAllocator::makeRoom(std::size_t bytes, void* keep)
+{
+  while (m_resident_bytes + bytes > m_host_limit_bytes && !m_lru.empty() && m_lru.back() != keep) {
+    void* victim{m_lru.back()};
+    spill(victim, m_records[victim]);
+  }
+}
+
+void OutOfCoreAllocator::spill(void* ptr, Record& record)
+{
+  UMPIRE_LOG(Debug, "Spilling " << record.size << " bytes at " << ptr);
+
+  const off_t offset{allocateFileRange(record.size)};
+
+  void* staging{mmap(nullptr, record.size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, offset)};
+  if (staging == MAP_FAILED) {
+    int errno_save = errno;
+    freeFileRange(offset, record.size);
+    UMPIRE_ERROR("mmap of " << record.size << " bytes of the spill file failed: " << strerror(errno_save));
+  }
+
+  // Copy the data to the file, then move the file mapping over the allocation
+  memcpy(staging, ptr, record.size);
+
+  if (mremap(staging, record.size, record.size, MREMAP_MAYMOVE | MREMAP_FIXED, ptr) == MAP_FAILED) {
+    int errno_save = errno;
+    munmap(staging, record.size);
+    freeFileRange(offset, record.size);
+    UMPIRE_ERROR("mremap of " << record.size << " bytes to " << ptr << " failed: " << strerror(errno_save));
+  }
+
+#if defined(MADV_PAGEOUT)
+  // Write the pages back now rather than waiting for memory pressure
+  madvise(ptr, record.size, MADV_PAGEOUT);
+#endif
+
+  m_lru.erase(record.lru);
+  record.lru = m_lru.end();
+  record.spilled = true;
+  record.offset = offset;
+
+  m_resident_bytes -= record.size;
+  m_spilled_bytes += record.size;
+}
+
+void OutOfCoreAllocator::unspill(void* ptr, Record& record)
+{
+  UMPIRE_LOG(Debug, "Restoring " << record.size << " bytes at " << ptr);
+
+  void* staging{mmap(nullptr, record.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+  if (staging == MAP_FAILED) {
+    UMPIRE_ERROR("mmap of " << record.size << " bytes failed: " << strerror(errno));
+  }
+
+  memcpy(staging, ptr, record.size);
+
+  if (mremap(staging, record.size, record.size, MREMAP_MAYMOVE | MREMAP_FIXED, ptr) == MAP_FAILED) {
+    int errno_save = errno;
+    munmap(staging, record.size);
+    UMPIRE_ERROR("mremap of " << record.size << " bytes to " << ptr << " failed: " << strerror(errno_save));
+  }
+
+  freeFileRange(record.offset, record.size);
+
+  m_lru.push_front(ptr);
+  record.lru = m_lru.begin();
+  record.spilled = false;
+
+  m_spilled_bytes -= record.size;
+  m_resident_bytes += record.size;
+}
+
+off_t OutOfCoreAllocator::allocateFileRange(std::size_t bytes)
+{
+  for (auto range = m_free_ranges.begin(); range != m_free_ranges.end(); ++range) {
+    if (range->second >= bytes) {
+      const off_t offset{range->first};
+      const std::size_t remaining{range->second - bytes};
+
+      m_free_ranges.erase(range);
+      if (remaining > 0) {
+        m_free_ranges.emplace(offset + static_cast<off_t>(bytes), remaining);
+      }
+
+      return offset;
+    }
+  }
+
+  // The file is sparse, blocks are allocated as the spilled pages are written
+  const off_t offset{m_file_size};
+  if (ftruncate64(m_fd, offset + static_cast<off_t>(bytes)) == -1) {
+    UMPIRE_ERROR("Growing the spill file to " << offset + bytes << " bytes failed: " << strerror(errno));
+  }
+  m_file_size += static_cast<off_t>(bytes);
+
+  return offset;
+}
+
+void OutOfCoreAllocator::freeFileRange(off_t offset, std::size_t bytes)
+{
+  // Give the disk space back to the file system
+  if (fallocate(m_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, offset, static_cast<off_t>(bytes)) == -1) {
+    UMPIRE_LOG(Debug, "Punching hole in the spill file failed: " << strerror(errno));
+  }
+
+  auto next = m_free_ranges.find(offset + static_cast<off_t>(bytes));
+  if (next != m_free_ranges.end()) {
+    bytes += next->second;
+    m_free_ranges.erase(next);
+  }
+
+  auto prev = m_free_ranges.lower_bound(offset);
+  if (prev != m_free_ranges.begin()) {
+    --prev;
+    if (prev->first + static_cast<off_t>(prev->second) == offset) {
+      offset = prev->first;
+      bytes += prev->second;
+      m_free_ranges.erase(prev);
+    }
+  }
+
+  m_free_ranges.emplace(offset, bytes);
+}
+
+const OutOfCoreAllocator::Record& OutOfCoreAllocator::findRecord(void* ptr) const
+{
+  auto iter = m_records.find(ptr);
+  if (iter == m_records.end()) {
+    UMPIRE_ERROR("OutOfCoreAllocator " << m_name << " does not own pointer " << ptr);
+  }
+
+  return iter->second;
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_OutOfCoreAllocator_HPP
+#define UMPIRE_OutOfCoreAllocator_HPP
+
+#include <sys/types.h>
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief Keep allocations within a host memory limit by spilling the least
+ * recently used ones to a file.
+ *
+ * Each allocation is mapped on its own, so the allocator given at
+ * construction must be the host memory resource, which only provides the
+ * platform and traits of the allocations. When an allocation would take the
+ * host memory in use above host_limit_bytes, the least recently used
+ * allocations are copied to a file in UMPIRE_MEMORY_FILE_DIR and the file is
+ * mapped in their place, so their pointers stay valid and their pages can be
+ * written back and evicted by the kernel. Spilled allocations can still be
+ * read and written directly, at the speed of the file system.
+ *
+ * Allocations are marked as recently used when they are allocated and when
+ * touch is called on them, which also brings a spilled allocation back into
+ * host memory.
+ *
+ * An allocation is copied while it moves between host memory and the file,
+ * so it must not be accessed by other threads during calls to allocate or
+ * touch that could move it, i.e. while it is among the least recently used.
+ */
+class OutOfCoreAllocator : public AllocationStrategy {
+ public:
+  /*!
+   * \brief Construct a new OutOfCoreAllocator.
+   *
+   * \param name Name of this instance of the OutOfCoreAllocator
+   * \param id Unique identifier for this instance
+   * \param allocator Host memory resource, e.g. HOST; pools and other
+   * strategies are rejected
+   * \param host_limit_bytes Host memory that allocations may use before they
+   * are spilled to the file
+   */
+  OutOfCoreAllocator(const std::string& name, int id, Allocator allocator, std::size_t host_limit_bytes);
+
+  ~OutOfCoreAllocator();
+
+  OutOfCoreAllocator(const OutOfCoreAllocator&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  /*!
+   * \brief Mark the allocation at ptr as recently used, bringing it back into
+   * host memory if it was spilled.
+   */
+  void touch(void* ptr);
+
+  /*!
+   * \brief Return whether the allocation at ptr is currently in the file.
+   */
+  bool isSpilled(void* ptr) const;
+
+  /*!
+   * \brief Return the number of bytes of allocations held in host memory.
+   */
+  std::size_t getResidentSize() const noexcept;
+
+  /*!
+   * \brief Return the number of bytes of allocations held in the file.
+   */
+  std::size_t getSpilledSize() const noexcept;
+
+ private:
+  struct Record {
+    std::size_t size;
+    bool spilled;
+    off_t offset;
+    std::list<void*>::iterator lru;
+  };
+
+  void makeRoom(std::size_t bytes, void* keep);
+  void spill(void* ptr, Record& record);
+  void unspill(void* ptr, Record& record);
+
+  off_t allocateFileRange(std::size_t bytes);
+  void freeFileRange(off_t offset, std::size_t bytes);
+
+  const Record& findRecord(void* ptr) const;
+
+  strategy::AllocationStrategy* m_allocator;
+
+  const std::size_t m_host_limit_bytes;
+  const std::size_t m_page_size;
+
+  std::unordered_map<void*, Record> m_records;
+
+  // Allocations in host memory, most recently used first
+  std::list<void*> m_lru;
+
+  std::size_t m_resident_bytes{0};
+  std::size_t m_spilled_bytes{0};
+
+  int m_fd{-1};
+  off_t m_file_size{0};
+  std::map<off_t, std::size_t> m_free_ranges;
+
+  mutable std::mutex m_mutex;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_OutOfCoreAllocator_HPP
@@ -7,15 +7,186 @@
 #ifndef UMPIRE_PoolCoalesceHeuristic_HPP
 #define UMPIRE_PoolCoalesceHeuristic_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <deque>
 #include <functional>
+#include <limits>
+#include <utility>
+
+#include "umpire/util/system_memory.hpp"
 
 namespace umpire {
 
 namespace strategy {
 
+/*!
+ * \brief Heuristic called by a pool at the end of each deallocate.
+ *
+ * The returned value is the size (in bytes) that the pool should be
+ * coalesced to, or 0 to leave the pool as it is.
+ */
 template <typename T>
 using PoolCoalesceHeuristic = std::function<std::size_t(const T&)>;
 
+/*!
+ * \brief Value that a PoolCoalesceHeuristic can return to make the pool
+ * release its free blocks to the underlying resource without allocating a
+ * new, coalesced block in their place.
+ */
+constexpr std::size_t release_free_blocks{std::numeric_limits<std::size_t>::max()};
+
+/*!
+ * \brief Value that a PoolCoalesceHeuristic can return to make a host pool
+ * decommit the pages of its free chunks, keeping the blocks themselves.
+ */
+constexpr std::size_t decommit_free_blocks{std::numeric_limits<std::size_t>::max() - 1};
+
+/*!
+ * \brief Decommit free memory whenever should_coalesce would have coalesced
+ * or released the pool.
+ *
+ * The pool keeps its blocks and address range, so a later burst is served
+ * without going back to the underlying resource and only pays for page
+ * faults.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> decommit_heuristic(PoolCoalesceHeuristic<Pool> should_coalesce)
+{
+  return [=](const Pool& pool) -> std::size_t { return (should_coalesce(pool) != 0) ? decommit_free_blocks : 0; };
+}
+
+/*!
+ * \brief Release free blocks once the pool has held releasable blocks for at
+ * least idle_time.
+ *
+ * The clock starts the first time the heuristic sees a releasable block and
+ * is reset whenever the pool has none.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> idle_releasable_heuristic(std::chrono::milliseconds idle_time)
+{
+  using clock = std::chrono::steady_clock;
+
+  bool idle{false};
+  clock::time_point idle_since{};
+
+  return [=](const Pool& pool) mutable -> std::size_t {
+    if (pool.getReleasableBlocks() == 0) {
+      idle = false;
+      return 0;
+    }
+
+    const auto now = clock::now();
+    if (!idle) {
+      idle = true;
+      idle_since = now;
+    }
+
+    if (now - idle_since >= idle_time) {
+      idle = false;
+      return release_free_blocks;
+    }
+
+    return 0;
+  };
+}
+
+/*!
+ * \brief Release free blocks while available host memory is below
+ * min_available_bytes.
+ *
+ * Available memory is sampled at most once per poll_interval to keep the
+ * cost off the deallocate path.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> pressure_releasable_heuristic(std::size_t min_available_bytes,
+                                                          std::chrono::milliseconds poll_interval)
+{
+  using clock = std::chrono::steady_clock;
+
+  bool under_pressure{false};
+  bool sampled{false};
+  clock::time_point last_sample{};
+
+  return [=](const Pool& pool) mutable -> std::size_t {
+    if (pool.getReleasableBlocks() == 0) {
+      return 0;
+    }
+
+    const auto now = clock::now();
+    if (!sampled || now - last_sample >= poll_interval) {
+      under_pressure = util::get_available_host_memory() < min_available_bytes;
+      last_sample = now;
+      sampled = true;
+    }
+
+    return under_pressure ? release_free_blocks : 0;
+  };
+}
+
+/*!
+ * \brief Coalesce the pool down to the largest in-use size seen over the
+ * last nsteps deallocations.
+ *
+ * Each call of the heuristic is one step. Whenever the pool holds more than
+ * the windowed high-water mark and has releasable blocks, it is coalesced to
+ * that high-water mark, so a burst is still served from the pool while memory
+ * kept past it is returned. After coalescing, the pool is left alone until it
+ * grows again or the high-water mark drops.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> hwm_releasable_heuristic(std::size_t nsteps)
+{
+  // Monotonically decreasing (step, current size) samples
+  std::deque<std::pair<std::size_t, std::size_t>> window{};
+  std::size_t step{0};
+  const std::size_t window_steps{(nsteps > 0) ? nsteps : 1};
+
+  bool coalesced{false};
+  std::size_t coalesced_hwm{0};
+  std::size_t coalesced_actual{0};
+
+  return [=](const Pool& pool) mutable -> std::size_t {
+    const std::size_t current{pool.getCurrentSize()};
+    const std::size_t actual{pool.getActualSize()};
+
+    while (!window.empty() && window.back().second <= current) {
+      window.pop_back();
+    }
+    window.emplace_back(step, current);
+
+    while (window.front().first + window_steps <= step) {
+      window.pop_front();
+    }
+    step++;
+
+    const std::size_t hwm{window.front().second};
+
+    if (coalesced) {
+      if (coalesced_actual == 0) {
+        // First look at the pool since it was coalesced
+        coalesced_actual = actual;
+      }
+
+      if (actual <= coalesced_actual && hwm >= coalesced_hwm) {
+        return 0;
+      }
+      coalesced = false;
+    }
+
+    if (pool.getReleasableBlocks() == 0 || actual <= hwm) {
+      return 0;
+    }
+
+    coalesced = true;
+    coalesced_hwm = hwm;
+    coalesced_actual = 0;
+
+    return (hwm == 0) ? release_free_blocks : hwm;
+  };
+}
+
 } // end of namespace strategy
 } // end namespace umpire
 
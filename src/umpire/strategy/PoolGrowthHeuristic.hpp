@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_PoolGrowthHeuristic_HPP
+#define UMPIRE_PoolGrowthHeuristic_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "umpire/util/pool_size_store.hpp"
+
+namespace umpire {
+
+namespace strategy {
+
+/*!
+ * \brief Heuristic called by a pool whenever it has no free chunk for an
+ * allocation of the given (aligned) number of bytes.
+ *
+ * The returned value is the size of the new block the pool allocates. The
+ * pool never allocates a block smaller than the requested bytes, so the
+ * heuristic may return less.
+ */
+template <typename T>
+using PoolGrowthHeuristic = std::function<std::size_t(const T&, std::size_t)>;
+
+/*!
+ * \brief Grow by the first block size when the pool is empty, and by the
+ * next block size otherwise.
+ */
+template <typename Pool>
+PoolGrowthHeuristic<Pool> fixed_growth_heuristic()
+{
+  return [](const Pool& pool, std::size_t) -> std::size_t {
+    return (pool.getActualSize() == 0) ? pool.getFirstBlockSize() : pool.getNextBlockSize();
+  };
+}
+
+/*!
+ * \brief Grow the pool geometrically, by a factor of its actual size.
+ *
+ * Each new block is (factor - 1) times the actual size of the pool, or the
+ * bytes allocated since the pool last grew if that is more, so a pool under
+ * steady demand reaches its working size in a number of blocks logarithmic
+ * in that size. Blocks are at least the next block size and, unless a single
+ * allocation needs more, at most max_block_size.
+ *
+ * An empty pool gets a first block of the first block size, or of the
+ * highest actual size the pool reached before, so a pool that released all
+ * of its blocks comes back in a single block.
+ */
+template <typename Pool>
+PoolGrowthHeuristic<Pool> geometric_growth_heuristic(double factor, std::size_t max_block_size)
+{
+  // Current size of the pool right after it last grew
+  std::size_t grown_at{0};
+
+  return [=](const Pool& pool, std::size_t bytes) mutable -> std::size_t {
+    const std::size_t actual{pool.getActualSize()};
+    const std::size_t current{pool.getCurrentSize()};
+    std::size_t size{0};
+
+    if (actual == 0) {
+      size = std::max(pool.getFirstBlockSize(), pool.getActualHighwaterMark());
+    } else {
+      const std::size_t demand{(current > grown_at) ? current - grown_at : 0};
+      size = std::max(static_cast<std::size_t>((factor - 1.0) * static_cast<double>(actual)), demand);
+      size = std::max(std::min(size, max_block_size), pool.getNextBlockSize());
+    }
+
+    grown_at = current + bytes;
+    return size;
+  };
+}
+
+/*!
+ * \brief Remember the highest actual size of the pool across runs.
+ *
+ * The highest actual size is stored in filename under the pool's name each
+ * time the pool grows past it, and the next run with the same file starts
+ * the pool with a first block of that size. Between those, the pool grows as
+ * growth decides. The stored size is never lowered, so remove the pool's
+ * line from the file to start over.
+ */
+template <typename Pool>
+PoolGrowthHeuristic<Pool> persistent_growth_heuristic(const std::string& filename, PoolGrowthHeuristic<Pool> growth)
+{
+  bool loaded{false};
+  std::size_t stored_size{0};
+
+  return [=](const Pool& pool, std::size_t bytes) mutable -> std::size_t {
+    if (!loaded) {
+      stored_size = util::read_pool_size(filename, pool.getName());
+      loaded = true;
+    }
+
+    std::size_t size{growth(pool, bytes)};
+    if (pool.getActualSize() == 0) {
+      size = std::max(size, stored_size);
+    }
+
+    const std::size_t actual{pool.getActualSize() + std::max(size, bytes)};
+    if (actual > stored_size) {
+      stored_size = actual;
+      util::write_pool_size(filename, pool.getName(), stored_size);
+    }
+
+    return size;
+  };
+}
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_PoolGrowthHeuristic_HPP
@@ -6,12 +6,16 @@
 
 #include "umpire/strategy/QuickPool.hpp"
 
+#include <limits>
+
 #include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/mixins/AlignedAllocation.hpp"
 #include "umpire/util/FixedMallocPool.hpp"
 #include "umpire/util/Macros.hpp"
 #include "umpire/util/memory_sanitizers.hpp"
+#include "umpire/util/system_memory.hpp"
 
 namespace umpire {
 namespace strategy {
@@ -19,10 +23,12 @@ namespace strategy {
 QuickPool::QuickPool(const std::string& name, int id, Allocator allocator,
                      const std::size_t first_minimum_pool_allocation_size,
                      const std::size_t next_minimum_pool_allocation_size, std::size_t alignment,
-                     PoolCoalesceHeuristic<QuickPool> should_coalesce) noexcept
+                     PoolCoalesceHeuristic<QuickPool> should_coalesce, Prewarm prewarm,
+                     PoolGrowthHeuristic<QuickPool> grow) noexcept
     : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "QuickPool"},
       mixins::AlignedAllocation{alignment, allocator.getAllocationStrategy()},
       m_should_coalesce{should_coalesce},
+      m_grow{grow},
       m_first_minimum_pool_allocation_size{first_minimum_pool_allocation_size},
       m_next_minimum_pool_allocation_size{next_minimum_pool_allocation_size}
 {
@@ -31,7 +37,13 @@ QuickPool::QuickPool(const std::string& name, int id, Allocator allocator,
                         << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
                         << ", first_minimum_pool_allocation_size=" << m_first_minimum_pool_allocation_size
                         << ", next_minimum_pool_allocation_size=" << m_next_minimum_pool_allocation_size
-                        << ", alignment=" << alignment << " )");
+                        << ", alignment=" << alignment << ", prewarm=" << prewarm << " )");
+
+  try {
+    this->prewarm(prewarm);
+  } catch (...) {
+    UMPIRE_LOG(Error, "Caught error prewarming pool, first block will be allocated on demand");
+  }
 }
 
 QuickPool::~QuickPool()
@@ -39,62 +51,156 @@ QuickPool::~QuickPool()
   UMPIRE_LOG(Debug, "Releasing free blocks to device");
   m_is_destructing = true;
   release();
+
+  // Blocks still in use are not released, but must not be found any more
+  if (m_owns_records) {
+    for (const auto& block : m_blocks) {
+      unindex_block(block.first);
+    }
+  }
 }
 
 void* QuickPool::allocate(std::size_t bytes)
 {
   UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+  auto lock = lock_if_owner();
+  return do_allocate(bytes);
+}
+
+void* QuickPool::do_allocate(std::size_t bytes)
+{
   const std::size_t rounded_bytes{aligned_round_up(bytes)};
   const auto& best = m_size_map.lower_bound(rounded_bytes);
 
   Chunk* chunk{nullptr};
 
   if (best == m_size_map.end()) {
-    std::size_t bytes_to_use{(m_actual_bytes == 0) ? m_first_minimum_pool_allocation_size
-                                                   : m_next_minimum_pool_allocation_size};
+    chunk = allocate_block(rounded_bytes);
+  } else {
+    chunk = (*best).second;
+    m_free_stats.erase(chunk->size);
+    m_size_map.erase(best);
+  }
 
-    std::size_t size{(rounded_bytes > bytes_to_use) ? rounded_bytes : bytes_to_use};
+  return use_chunk(chunk, rounded_bytes, bytes);
+}
 
-    UMPIRE_LOG(Debug, "Allocating new chunk of size " << size);
+void* QuickPool::allocate_aligned(std::size_t bytes, std::size_t alignment)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ", alignment=" << alignment << ")");
+  if (alignment <= getAlignment()) {
+    return allocate(bytes);
+  }
 
-    void* ret{nullptr};
-    try {
+  auto lock = lock_if_owner();
+  const std::size_t rounded_bytes{aligned_round_up(bytes)};
+  // Chunks start at a multiple of the pool's alignment, so a free chunk of
+  // this size fits wherever it starts
+  const std::size_t padded_bytes{rounded_bytes + alignment - getAlignment()};
+
+  Chunk* chunk{nullptr};
+
+  for (auto best = m_size_map.lower_bound(rounded_bytes); best != m_size_map.end(); ++best) {
+    if ((*best).first >= padded_bytes ||
+        aligned_padding((*best).second->data, alignment) + rounded_bytes <= (*best).first) {
+      chunk = (*best).second;
+      m_free_stats.erase(chunk->size);
+      m_size_map.erase(best);
+      break;
+    }
+  }
+
+  if (!chunk) {
+    chunk = allocate_block(padded_bytes);
+  }
+
+  const std::size_t padding{aligned_padding(chunk->data, alignment)};
+  if (padding != 0) {
+    UMPIRE_LOG(Debug, "Splitting " << padding << " bytes off chunk " << chunk << " to align it");
+
+    if (chunk->size == chunk->chunk_size) {
+      m_releasable_bytes -= chunk->chunk_size;
+      m_releasable_blocks--;
+    }
+
+    void* chunk_storage{m_chunk_pool.allocate()};
+    Chunk* aligned_chunk{new (chunk_storage) Chunk{static_cast<char*>(chunk->data) + padding, chunk->size - padding,
+                                                   chunk->chunk_size}};
+    aligned_chunk->decommitted = chunk->decommitted;
+
+    aligned_chunk->prev = chunk;
+    aligned_chunk->next = chunk->next;
+    if (aligned_chunk->next)
+      aligned_chunk->next->prev = aligned_chunk;
+    chunk->next = aligned_chunk;
+
+    chunk->size = padding;
+    chunk->size_map_it = m_size_map.insert(std::make_pair(padding, chunk));
+    m_free_stats.insert(padding);
+
+    chunk = aligned_chunk;
+  }
+
+  return use_chunk(chunk, rounded_bytes, bytes);
+}
+
+bool QuickPool::allocatesAligned() const noexcept
+{
+  return true;
+}
+
+QuickPool::Chunk* QuickPool::allocate_block(std::size_t rounded_bytes)
+{
+  std::size_t bytes_to_use{aligned_round_up(m_grow(*this, rounded_bytes))};
+
+  std::size_t size{(rounded_bytes > bytes_to_use) ? rounded_bytes : bytes_to_use};
+
+  UMPIRE_LOG(Debug, "Allocating new chunk of size " << size);
+
+  void* ret{nullptr};
+  try {
 #if defined(UMPIRE_ENABLE_BACKTRACE)
-      {
-        umpire::util::backtrace bt;
-        umpire::util::backtracer<>::get_backtrace(bt);
-        UMPIRE_LOG(Info, "actual_size:" << (m_actual_bytes + rounded_bytes) << " (prev: " << m_actual_bytes << ") "
-                                        << umpire::util::backtracer<>::print(bt));
-      }
+    {
+      umpire::util::backtrace bt;
+      umpire::util::backtracer<>::get_backtrace(bt);
+      UMPIRE_LOG(Info, "actual_size:" << (m_actual_bytes + rounded_bytes) << " (prev: " << m_actual_bytes << ") "
+                                      << umpire::util::backtracer<>::print(bt));
+    }
 #endif
+    ret = aligned_allocate(size); // Will Poison
+  } catch (...) {
+    UMPIRE_LOG(Error,
+               "Caught error allocating new chunk, giving up free chunks and "
+               "retrying...");
+    do_release();
+    try {
       ret = aligned_allocate(size); // Will Poison
+      UMPIRE_LOG(Debug, "memory reclaimed, chunk successfully allocated.");
     } catch (...) {
-      UMPIRE_LOG(Error,
-                 "Caught error allocating new chunk, giving up free chunks and "
-                 "retrying...");
-      release();
-      try {
-        ret = aligned_allocate(size); // Will Poison
-        UMPIRE_LOG(Debug, "memory reclaimed, chunk successfully allocated.");
-      } catch (...) {
-        UMPIRE_LOG(Error, "recovery failed.");
-        throw;
-      }
+      UMPIRE_LOG(Error, "recovery failed.");
+      throw;
     }
+  }
 
-    m_actual_bytes += size;
-    m_releasable_bytes += size;
-    m_releasable_blocks++;
-    m_total_blocks++;
-    m_actual_highwatermark = (m_actual_bytes > m_actual_highwatermark) ? m_actual_bytes : m_actual_highwatermark;
+  m_actual_bytes += size;
+  m_releasable_bytes += size;
+  m_releasable_blocks++;
+  m_total_blocks++;
+  m_actual_highwatermark = (m_actual_bytes > m_actual_highwatermark) ? m_actual_bytes : m_actual_highwatermark;
 
-    void* chunk_storage{m_chunk_pool.allocate()};
-    chunk = new (chunk_storage) Chunk{ret, size, size};
-  } else {
-    chunk = (*best).second;
-    m_size_map.erase(best);
+  void* chunk_storage{m_chunk_pool.allocate()};
+  Chunk* chunk{new (chunk_storage) Chunk{ret, size, size}};
+
+  m_blocks.insert(std::make_pair(ret, chunk));
+  if (m_owns_records) {
+    index_block(ret, size);
   }
 
+  return chunk;
+}
+
+void* QuickPool::use_chunk(Chunk* chunk, std::size_t rounded_bytes, std::size_t bytes)
+{
   UMPIRE_LOG(Debug, "Using chunk " << chunk << " with data " << chunk->data << " and size " << chunk->size
                                    << " for allocation of size " << rounded_bytes);
 
@@ -107,6 +213,8 @@ void* QuickPool::allocate(std::size_t bytes)
   m_pointer_map.insert(std::make_pair(ret, chunk));
 
   chunk->free = false;
+  const bool decommitted{chunk->decommitted};
+  chunk->decommitted = false;
 
   if (rounded_bytes != chunk->size) {
     std::size_t remaining{chunk->size - rounded_bytes};
@@ -115,6 +223,8 @@ void* QuickPool::allocate(std::size_t bytes)
     void* chunk_storage{m_chunk_pool.allocate()};
     Chunk* split_chunk{new (chunk_storage)
                            Chunk{static_cast<char*>(ret) + rounded_bytes, remaining, chunk->chunk_size}};
+    // The whole pages of the rest were whole pages of the chunk
+    split_chunk->decommitted = decommitted;
 
     auto old_next = chunk->next;
     chunk->next = split_chunk;
@@ -126,6 +236,7 @@ void* QuickPool::allocate(std::size_t bytes)
 
     chunk->size = rounded_bytes;
     split_chunk->size_map_it = m_size_map.insert(std::make_pair(remaining, split_chunk));
+    m_free_stats.insert(remaining);
   }
 
   m_current_bytes += rounded_bytes;
@@ -134,9 +245,82 @@ void* QuickPool::allocate(std::size_t bytes)
   return ret;
 }
 
+void QuickPool::allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ", bytes=" << bytes << ")");
+  if (count == 0) {
+    return;
+  }
+
+  const std::size_t rounded_bytes{aligned_round_up(bytes)};
+  if (rounded_bytes < bytes || (rounded_bytes > 0 && count > std::numeric_limits<std::size_t>::max() / rounded_bytes)) {
+    UMPIRE_ERROR("Cannot allocate " << count << " blocks of " << bytes << " bytes, the total size overflows");
+  }
+
+  auto lock = lock_if_owner();
+  void* ret{do_allocate(count * rounded_bytes)};
+  Chunk* chunk{m_pointer_map[ret]};
+
+  chunk->size = rounded_bytes;
+  ptrs[0] = ret;
+
+  for (std::size_t i = 1; i < count; ++i) {
+    void* chunk_storage{m_chunk_pool.allocate()};
+    Chunk* split_chunk{new (chunk_storage)
+                           Chunk{static_cast<char*>(ret) + i * rounded_bytes, rounded_bytes, chunk->chunk_size}};
+    split_chunk->free = false;
+
+    split_chunk->prev = chunk;
+    split_chunk->next = chunk->next;
+    if (split_chunk->next)
+      split_chunk->next->prev = split_chunk;
+    chunk->next = split_chunk;
+
+    m_pointer_map.insert(std::make_pair(split_chunk->data, split_chunk));
+    ptrs[i] = split_chunk->data;
+    chunk = split_chunk;
+  }
+}
+
 void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 {
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+  {
+    auto lock = lock_if_owner();
+    free_chunk(ptr);
+  }
+  apply_coalesce_heuristic();
+}
+
+void QuickPool::deallocate_bulk(void* const* ptrs, const std::size_t* UMPIRE_UNUSED_ARG(sizes), std::size_t count)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+  {
+    auto lock = lock_if_owner();
+    for (std::size_t i = 0; i < count; ++i) {
+      free_chunk(ptrs[i]);
+    }
+  }
+  apply_coalesce_heuristic();
+}
+
+void QuickPool::apply_coalesce_heuristic()
+{
+  std::size_t suggested_size{m_should_coalesce(*this)};
+  if (release_free_blocks == suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic requested release of free blocks.");
+    release();
+  } else if (decommit_free_blocks == suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic requested decommit of free blocks.");
+    decommit();
+  } else if (0 != suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce.");
+    do_coalesce(suggested_size);
+  }
+}
+
+void QuickPool::free_chunk(void* ptr)
+{
   auto chunk = (*m_pointer_map.find(ptr)).second;
   chunk->free = true;
 
@@ -151,6 +335,7 @@ void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
     UMPIRE_LOG(Debug, "Removing chunk" << prev << " from size map");
 
     m_size_map.erase(prev->size_map_it);
+    m_free_stats.erase(prev->size);
 
     prev->size += chunk->size;
     prev->next = chunk->next;
@@ -161,6 +346,7 @@ void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
     UMPIRE_LOG(Debug, "Merging with prev" << prev << " and " << chunk);
     UMPIRE_LOG(Debug, "New size: " << prev->size);
 
+    chunk->~Chunk();
     m_chunk_pool.deallocate(chunk);
     chunk = prev;
   }
@@ -177,29 +363,58 @@ void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 
     UMPIRE_LOG(Debug, "Removing chunk" << next << " from size map");
     m_size_map.erase(next->size_map_it);
+    m_free_stats.erase(next->size);
 
+    next->~Chunk();
     m_chunk_pool.deallocate(next);
   }
 
   UMPIRE_LOG(Debug, "Inserting chunk " << chunk << " with size " << chunk->size);
 
+  // The pages of the freed allocation, and those it joins, are committed
+  chunk->decommitted = false;
+
   if (chunk->size == chunk->chunk_size) {
     m_releasable_blocks++;
     m_releasable_bytes += chunk->chunk_size;
   }
 
   chunk->size_map_it = m_size_map.insert(std::make_pair(chunk->size, chunk));
+  m_free_stats.insert(chunk->size);
   // can do this with iterator?
   m_pointer_map.erase(ptr);
+}
 
-  std::size_t suggested_size{m_should_coalesce(*this)};
-  if (0 != suggested_size) {
-    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce.");
-    do_coalesce(suggested_size);
+void QuickPool::prewarm(Prewarm prewarm)
+{
+  if (prewarm == Prewarm::none || m_first_minimum_pool_allocation_size == 0) {
+    return;
+  }
+
+  UMPIRE_LOG(Debug, "Allocating first block of size " << m_first_minimum_pool_allocation_size);
+  void* ptr{allocate(m_first_minimum_pool_allocation_size)};
+
+  if (prewarm == Prewarm::prefault) {
+    if (m_allocator->getTraits().resource == MemoryResourceTraits::resource_type::host) {
+      // The growth heuristic may have made the block larger
+      util::prefault_host_memory(ptr, m_pointer_map[ptr]->chunk_size);
+    } else {
+      UMPIRE_LOG(Debug, "Pool is not in host memory, skipping prefault");
+    }
   }
+
+  // Return the block to the pool without giving the heuristic a chance to
+  // release it again
+  free_chunk(ptr);
 }
 
 void QuickPool::release()
+{
+  auto lock = lock_if_owner();
+  do_release();
+}
+
+void QuickPool::do_release()
 {
   UMPIRE_LOG(Debug, "() " << m_size_map.size() << " chunks in free map, m_is_destructing set to " << m_is_destructing);
 
@@ -218,6 +433,11 @@ void QuickPool::release()
       m_releasable_blocks--;
       m_total_blocks--;
 
+      m_blocks.erase(chunk->data);
+      if (m_owns_records) {
+        unindex_block(chunk->data);
+      }
+
       try {
         aligned_deallocate(chunk->data);
       } catch (...) {
@@ -231,6 +451,8 @@ void QuickPool::release()
         }
       }
 
+      m_free_stats.erase(chunk->size);
+      chunk->~Chunk();
       m_chunk_pool.deallocate(chunk);
       pair = m_size_map.erase(pair);
     } else {
@@ -281,6 +503,16 @@ std::size_t QuickPool::getActualHighwaterMark() const noexcept
   return m_actual_highwatermark;
 }
 
+std::size_t QuickPool::getFirstBlockSize() const noexcept
+{
+  return m_first_minimum_pool_allocation_size;
+}
+
+std::size_t QuickPool::getNextBlockSize() const noexcept
+{
+  return m_next_minimum_pool_allocation_size;
+}
+
 Platform QuickPool::getPlatform() noexcept
 {
   return m_allocator->getPlatform();
@@ -296,6 +528,125 @@ bool QuickPool::tracksMemoryUse() const noexcept
   return false;
 }
 
+bool QuickPool::ownsAllocationRecords() const noexcept
+{
+  return true;
+}
+
+util::AllocationRecord* QuickPool::findAllocationRecord(void* ptr) noexcept
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  auto iter = m_pointer_map.find(ptr);
+  if (iter != m_pointer_map.end()) {
+    return iter->second->record.strategy ? &iter->second->record : nullptr;
+  }
+
+  // An offset pointer, so walk the chunks of the block containing it
+  auto block = m_blocks.upper_bound(ptr);
+  if (block == m_blocks.begin()) {
+    return nullptr;
+  }
+  --block;
+
+  char* address{static_cast<char*>(ptr)};
+  for (Chunk* chunk = block->second; chunk && static_cast<char*>(chunk->data) <= address; chunk = chunk->next) {
+    if (address < static_cast<char*>(chunk->data) + chunk->size) {
+      const util::AllocationRecord& record{chunk->record};
+      if (record.strategy && address < static_cast<char*>(record.ptr) + record.size) {
+        return &chunk->record;
+      }
+      return nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+bool QuickPool::insertAllocationRecord(const util::AllocationRecord& record)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  auto iter = m_pointer_map.find(record.ptr);
+  if (iter == m_pointer_map.end()) {
+    return false;
+  }
+
+  // The first record makes this pool an owner, so its blocks become
+  // reachable through the ResourceManager from now on
+  if (!m_owns_records) {
+    for (const auto& block : m_blocks) {
+      index_block(block.first, block.second->chunk_size);
+    }
+    m_owns_records = true;
+  }
+
+  // Blocks inside the range of another pool cannot be indexed, so the
+  // ResourceManager keeps the records of their allocations
+  if (!m_unindexed_blocks.empty()) {
+    auto block = m_blocks.upper_bound(record.ptr);
+    --block;
+    if (m_unindexed_blocks.count(block->first)) {
+      return false;
+    }
+  }
+
+  iter->second->record = record;
+  return true;
+}
+
+bool QuickPool::removeAllocationRecord(void* ptr, util::AllocationRecord* record) noexcept
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  auto iter = m_pointer_map.find(ptr);
+  if (iter == m_pointer_map.end() || !iter->second->record.strategy) {
+    return false;
+  }
+
+  if (record) {
+    *record = std::move(iter->second->record);
+  }
+  iter->second->record = util::AllocationRecord{};
+
+  return true;
+}
+
+std::unique_lock<std::mutex> QuickPool::lock_if_owner()
+{
+  // Only the thread using the pool sets m_owns_records, and other threads
+  // reach the pool through the ResourceManager only once it is set
+  std::unique_lock<std::mutex> lock{m_mutex, std::defer_lock};
+  if (m_owns_records) {
+    lock.lock();
+  }
+  return lock;
+}
+
+void QuickPool::index_block(void* data, std::size_t size)
+{
+  if (!ResourceManager::getInstance().registerOwnedRange(data, size, this)) {
+    UMPIRE_LOG(Debug, "Block " << data << " lies in a range owned by another strategy, not indexing it");
+    m_unindexed_blocks.insert(data);
+  }
+}
+
+void QuickPool::unindex_block(void* data)
+{
+  if (m_unindexed_blocks.erase(data) == 0) {
+    ResourceManager::getInstance().deregisterOwnedRange(data);
+  }
+}
+
+std::vector<util::AllocationRecord> QuickPool::getAllocationRecords() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  std::vector<util::AllocationRecord> records;
+  for (const auto& entry : m_pointer_map) {
+    if (entry.second->record.strategy) {
+      records.push_back(entry.second->record);
+    }
+  }
+  return records;
+}
+
 std::size_t QuickPool::getBlocksInPool() const noexcept
 {
   return m_pointer_map.size() + m_size_map.size();
@@ -309,6 +660,13 @@ std::size_t QuickPool::getLargestAvailableBlock() noexcept
   return m_size_map.rbegin()->first;
 }
 
+util::FreeBlockStatistics QuickPool::getFreeStatistics() const noexcept
+{
+  util::FreeBlockStatistics stats{m_free_stats};
+  stats.largest_free = m_size_map.empty() ? 0 : m_size_map.rbegin()->first;
+  return stats;
+}
+
 void QuickPool::coalesce() noexcept
 {
   UMPIRE_LOG(Debug, "()");
@@ -331,12 +689,85 @@ void QuickPool::do_coalesce(std::size_t suggested_size) noexcept
   }
 }
 
+std::size_t QuickPool::decommit(bool lazy) noexcept
+{
+  UMPIRE_LOG(Debug, "(lazy=" << lazy << ")");
+
+  if (m_allocator->getTraits().resource != MemoryResourceTraits::resource_type::host) {
+    UMPIRE_LOG(Debug, "Pool is not in host memory, nothing to decommit");
+    return 0;
+  }
+
+  const std::size_t page_size{util::host_page_size()};
+
+  auto lock = lock_if_owner();
+  std::size_t decommitted{0};
+  // The size map is ordered by size, so the chunks holding no whole page
+  // come first
+  for (auto pair = m_size_map.lower_bound(page_size); pair != m_size_map.end(); ++pair) {
+    auto chunk = pair->second;
+    if (!chunk->decommitted) {
+      const std::size_t bytes{util::decommit_host_memory(chunk->data, chunk->size, lazy)};
+      chunk->decommitted = (bytes > 0) && !lazy;
+      decommitted += bytes;
+    }
+  }
+
+  UMPIRE_LOG(Debug, "Decommitted " << decommitted << " bytes from " << m_size_map.size() << " free chunks");
+  return decommitted;
+}
+
 PoolCoalesceHeuristic<QuickPool> QuickPool::blocks_releasable(std::size_t nblocks)
 {
   return
       [=](const strategy::QuickPool& pool) { return pool.getReleasableBlocks() > nblocks ? pool.getActualSize() : 0; };
 }
 
+PoolCoalesceHeuristic<QuickPool> QuickPool::idle_releasable(std::chrono::milliseconds idle_time)
+{
+  return idle_releasable_heuristic<QuickPool>(idle_time);
+}
+
+PoolCoalesceHeuristic<QuickPool> QuickPool::pressure_releasable(std::size_t min_available_bytes,
+                                                               std::chrono::milliseconds poll_interval)
+{
+  return pressure_releasable_heuristic<QuickPool>(min_available_bytes, poll_interval);
+}
+
+PoolCoalesceHeuristic<QuickPool> QuickPool::hwm_releasable(std::size_t nsteps)
+{
+  if (nsteps == 0) {
+    UMPIRE_ERROR("Invalid number of steps " << nsteps << ", nsteps must be greater than 0");
+  }
+
+  return hwm_releasable_heuristic<QuickPool>(nsteps);
+}
+
+PoolCoalesceHeuristic<QuickPool> QuickPool::decommit_releasable(PoolCoalesceHeuristic<QuickPool> should_coalesce)
+{
+  return decommit_heuristic<QuickPool>(should_coalesce);
+}
+
+PoolGrowthHeuristic<QuickPool> QuickPool::fixed_growth()
+{
+  return fixed_growth_heuristic<QuickPool>();
+}
+
+PoolGrowthHeuristic<QuickPool> QuickPool::geometric_growth(double factor, std::size_t max_block_size)
+{
+  if (factor <= 1.0) {
+    UMPIRE_ERROR("Invalid growth factor of " << factor << ", factor must be greater than 1");
+  }
+
+  return geometric_growth_heuristic<QuickPool>(factor, max_block_size);
+}
+
+PoolGrowthHeuristic<QuickPool> QuickPool::persistent_growth(const std::string& filename,
+                                                            PoolGrowthHeuristic<QuickPool> growth)
+{
+  return persistent_growth_heuristic<QuickPool>(filename, growth);
+}
+
 PoolCoalesceHeuristic<QuickPool> QuickPool::percent_releasable(int percentage)
 {
   if (percentage < 0 || percentage > 100) {
@@ -365,5 +796,23 @@ std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolCoalesceHeuris
   return out;
 }
 
+std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolGrowthHeuristic<QuickPool>&)
+{
+  return out;
+}
+
+std::ostream& operator<<(std::ostream& out, QuickPool::Prewarm prewarm)
+{
+  switch (prewarm) {
+    case QuickPool::Prewarm::none:
+      return out << "none";
+    case QuickPool::Prewarm::allocate:
+      return out << "allocate";
+    case QuickPool::Prewarm::prefault:
+      return out << "prefault";
+  }
+  return out;
+}
+
 } // end of namespace strategy
 } // end namespace umpire
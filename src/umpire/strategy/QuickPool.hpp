@@ -7,16 +7,22 @@
 #ifndef UMPIRE_QuickPool_HPP
 #define UMPIRE_QuickPool_HPP
 
+#include <chrono>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <set>
 #include <tuple>
 #include <unordered_map>
 
 #include "umpire/strategy/AllocationStrategy.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/PoolGrowthHeuristic.hpp"
 #include "umpire/strategy/mixins/AlignedAllocation.hpp"
+#include "umpire/util/AllocationRecord.hpp"
 #include "umpire/util/MemoryMap.hpp"
 #include "umpire/util/MemoryResourceTraits.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 
 namespace umpire {
 
@@ -37,9 +43,64 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   static PoolCoalesceHeuristic<QuickPool> percent_releasable(int percentage);
   static PoolCoalesceHeuristic<QuickPool> blocks_releasable(std::size_t nblocks);
 
+  /*!
+   * \brief Release free blocks after they have been releasable for idle_time.
+   */
+  static PoolCoalesceHeuristic<QuickPool> idle_releasable(std::chrono::milliseconds idle_time);
+
+  /*!
+   * \brief Release free blocks while available host memory (see
+   * util::get_available_host_memory) is below min_available_bytes.
+   */
+  static PoolCoalesceHeuristic<QuickPool> pressure_releasable(
+      std::size_t min_available_bytes, std::chrono::milliseconds poll_interval = std::chrono::milliseconds{100});
+
+  /*!
+   * \brief Coalesce the pool to the high-water mark of in-use bytes over the
+   * last nsteps deallocations.
+   */
+  static PoolCoalesceHeuristic<QuickPool> hwm_releasable(std::size_t nsteps);
+
+  /*!
+   * \brief Decommit free memory (see QuickPool::decommit) instead of
+   * coalescing whenever should_coalesce fires.
+   */
+  static PoolCoalesceHeuristic<QuickPool> decommit_releasable(PoolCoalesceHeuristic<QuickPool> should_coalesce);
+
+  /*!
+   * \brief Grow by the first block size, then by the next block size.
+   */
+  static PoolGrowthHeuristic<QuickPool> fixed_growth();
+
+  /*!
+   * \brief Grow the pool by a factor of its actual size, with blocks of at
+   * most max_block_size (see geometric_growth_heuristic).
+   */
+  static PoolGrowthHeuristic<QuickPool> geometric_growth(double factor = 2.0,
+                                                         std::size_t max_block_size = s_default_max_block_size);
+
+  /*!
+   * \brief Grow as growth decides, starting from the highest actual size the
+   * pool reached in previous runs as stored in filename (see
+   * persistent_growth_heuristic).
+   */
+  static PoolGrowthHeuristic<QuickPool> persistent_growth(const std::string& filename,
+                                                          PoolGrowthHeuristic<QuickPool> growth = geometric_growth());
+
+  /*!
+   * \brief What the pool does with its first block at construction.
+   *
+   * none leaves the first block to be allocated by the first allocate call,
+   * allocate allocates it eagerly, and prefault additionally faults in its
+   * pages using one thread per hardware thread (host memory only). To place
+   * the pages on a given NUMA node, build the pool on a NumaPolicy allocator.
+   */
+  enum class Prewarm { none, allocate, prefault };
+
   static constexpr std::size_t s_default_first_block_size{512 * 1024 * 1024};
   static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
   static constexpr std::size_t s_default_alignment{16};
+  static constexpr std::size_t s_default_max_block_size{1024 * 1024 * 1024};
 
   /*!
    * \brief Construct a new QuickPool.
@@ -51,13 +112,16 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
    * \param next_minimum_pool_allocation_size The minimum size of all future
    * allocations \param alignment Number of bytes with which to align allocation
    * sizes (power-of-2) \param should_coalesce Heuristic for when to perform
-   * coalesce operation
+   * coalesce operation \param prewarm Whether to allocate (and prefault) the
+   * first block at construction \param grow Heuristic for the size of the
+   * blocks the pool grows by
    */
   QuickPool(const std::string& name, int id, Allocator allocator,
             const std::size_t first_minimum_pool_allocation_size = s_default_first_block_size,
             const std::size_t next_minimum_pool_allocation_size = s_default_next_block_size,
             const std::size_t alignment = s_default_alignment,
-            PoolCoalesceHeuristic<QuickPool> should_coalesce = percent_releasable(100)) noexcept;
+            PoolCoalesceHeuristic<QuickPool> should_coalesce = percent_releasable(100),
+            Prewarm prewarm = Prewarm::none, PoolGrowthHeuristic<QuickPool> grow = fixed_growth()) noexcept;
 
   ~QuickPool();
 
@@ -65,12 +129,36 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
 
   void* allocate(std::size_t bytes) override;
   void deallocate(void* ptr, std::size_t size) override;
+
+  /*!
+   * \brief Allocate count blocks as one chunk, then split it into a chunk per
+   * block.
+   */
+  void allocate_bulk(std::size_t count, std::size_t bytes, void** ptrs) override;
+
+  /*!
+   * \brief Free count blocks, only calling the coalesce heuristic once after
+   * all of them are freed.
+   */
+  void deallocate_bulk(void* const* ptrs, const std::size_t* sizes, std::size_t count) override;
+
+  /*!
+   * \brief Allocate from a chunk starting at a multiple of alignment.
+   *
+   * Any bytes before that in the chunk used are split off as a free chunk of
+   * their own, so the allocation is neither padded nor given a header.
+   */
+  void* allocate_aligned(std::size_t bytes, std::size_t alignment) override;
+  bool allocatesAligned() const noexcept override;
+
   void release() override;
 
   std::size_t getActualSize() const noexcept override;
   std::size_t getCurrentSize() const noexcept override;
   std::size_t getReleasableSize() const noexcept;
   std::size_t getActualHighwaterMark() const noexcept;
+  std::size_t getFirstBlockSize() const noexcept;
+  std::size_t getNextBlockSize() const noexcept;
 
   Platform getPlatform() noexcept override;
 
@@ -78,6 +166,23 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
 
   bool tracksMemoryUse() const noexcept override;
 
+  /*!
+   * \brief QuickPool keeps the records of its tracked allocations in its
+   * chunks, so they are indexed once, by the pool's own pointer map.
+   *
+   * The pool only registers its blocks with the ResourceManager once it holds
+   * a record, that is once it is the tracked strategy of an Allocator. Pools
+   * used by another strategy are never asked for records. From then on the
+   * chunks and the records are guarded by the pool's mutex, so the records
+   * may be queried while the pool allocates on another thread; pools that
+   * hold no records take no lock.
+   */
+  bool ownsAllocationRecords() const noexcept override;
+  util::AllocationRecord* findAllocationRecord(void* ptr) noexcept override;
+  bool insertAllocationRecord(const util::AllocationRecord& record) override;
+  bool removeAllocationRecord(void* ptr, util::AllocationRecord* record) noexcept override;
+  std::vector<util::AllocationRecord> getAllocationRecords() const override;
+
   /*!
    * \brief Return the number of memory blocks -- both leased to application
    * and internal free memory -- that the pool holds.
@@ -93,15 +198,59 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
    */
   std::size_t getLargestAvailableBlock() noexcept;
 
+  /*!
+   * \brief Return statistics about the free chunks of the pool.
+   *
+   * The statistics are kept up to date as chunks are split and merged, so
+   * this does not walk the pool and can be called as often as needed, e.g.
+   * to sample util::relative_fragmentation.
+   */
+  util::FreeBlockStatistics getFreeStatistics() const noexcept;
+
   std::size_t getReleasableBlocks() const noexcept;
   std::size_t getTotalBlocks() const noexcept;
 
   void coalesce() noexcept;
   void do_coalesce(std::size_t suggested_size) noexcept;
 
+  /*!
+   * \brief Return the pages backing free chunks to the operating system.
+   *
+   * The page-aligned interior of every free chunk is decommitted with
+   * madvise, while the chunks stay in the pool. Chunks decommitted by an
+   * earlier call and not used since are skipped. This is only done for pools
+   * of host memory, and is a no-op otherwise.
+   *
+   * \param lazy Use MADV_FREE instead of MADV_DONTNEED where available.
+   *
+   * \return The number of bytes decommitted by this call.
+   */
+  std::size_t decommit(bool lazy = false) noexcept;
+
  private:
   struct Chunk;
 
+  void prewarm(Prewarm prewarm);
+
+  // allocate and release without taking m_mutex
+  void* do_allocate(std::size_t bytes);
+  void do_release();
+
+  // Lock m_mutex if the pool holds records, as lookups may then come from
+  // any thread; otherwise the pool is only used by its callers
+  std::unique_lock<std::mutex> lock_if_owner();
+
+  // Register a block with the ResourceManager, or remember that it could not
+  // be, and undo either once the block is released
+  void index_block(void* data, std::size_t size);
+  void unindex_block(void* data);
+  // Allocate a new block of at least rounded_bytes, as a single free chunk
+  Chunk* allocate_block(std::size_t rounded_bytes);
+  // Allocate rounded_bytes from the start of chunk, which is free
+  void* use_chunk(Chunk* chunk, std::size_t rounded_bytes, std::size_t bytes);
+  void free_chunk(void* ptr);
+  void apply_coalesce_heuristic();
+
   template <typename Value>
   class pool_allocator {
    public:
@@ -145,17 +294,26 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
     std::size_t size{0};
     std::size_t chunk_size{0};
     bool free{true};
+    // Set once the whole pages of a free chunk have been decommitted, other
+    // than lazily, as lazily freed pages may still be resident
+    bool decommitted{false};
     Chunk* prev{nullptr};
     Chunk* next{nullptr};
     SizeMap::iterator size_map_it;
+    // Set while the chunk holds a tracked allocation
+    util::AllocationRecord record{};
   };
 
   PointerMap m_pointer_map{};
+  // First chunk of each block, by address
+  std::map<void*, Chunk*> m_blocks{};
   SizeMap m_size_map{};
+  util::FreeBlockStatistics m_free_stats{};
 
   util::FixedMallocPool m_chunk_pool{sizeof(Chunk)};
 
   PoolCoalesceHeuristic<QuickPool> m_should_coalesce;
+  PoolGrowthHeuristic<QuickPool> m_grow;
 
   const std::size_t m_first_minimum_pool_allocation_size;
   const std::size_t m_next_minimum_pool_allocation_size;
@@ -167,9 +325,17 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   std::size_t m_releasable_bytes{0};
   std::size_t m_actual_highwatermark{0};
   bool m_is_destructing{false};
+  // Set once the blocks are registered with the ResourceManager
+  bool m_owns_records{false};
+  // Blocks that overlap a range registered by another strategy
+  std::set<void*> m_unindexed_blocks{};
+
+  mutable std::mutex m_mutex;
 };
 
 std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolCoalesceHeuristic<QuickPool>&);
+std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolGrowthHeuristic<QuickPool>&);
+std::ostream& operator<<(std::ostream& out, QuickPool::Prewarm prewarm);
 
 } // end of namespace strategy
 } // end namespace umpire
@@ -0,0 +1,205 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/ThreadHeapPool.hpp"
+
+#include <algorithm>
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+ThreadHeapPool::Heap::Heap(const std::string& name, int id, Allocator allocator,
+                           std::size_t first_minimum_pool_allocation_size,
+                           std::size_t next_minimum_pool_allocation_size, std::size_t alignment)
+    : pool{name,
+           id,
+           allocator,
+           first_minimum_pool_allocation_size,
+           next_minimum_pool_allocation_size,
+           alignment,
+           QuickPool::percent_releasable(0)}
+{
+}
+
+ThreadHeapPool::ThreadHeapPool(const std::string& name, int id, Allocator allocator,
+                               const std::size_t first_minimum_pool_allocation_size,
+                               const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "ThreadHeapPool"},
+      m_parent{allocator},
+      m_allocator{allocator.getAllocationStrategy()},
+      m_first_minimum_pool_allocation_size{first_minimum_pool_allocation_size},
+      m_next_minimum_pool_allocation_size{next_minimum_pool_allocation_size},
+      m_alignment{alignment},
+      m_header_size{std::max(alignment, sizeof(BlockHeader))}
+{
+  if (allocator.getPlatform() != Platform::host) {
+    UMPIRE_ERROR("ThreadHeapPool error: allocator is not host accessible");
+  }
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", first_minimum_pool_allocation_size=" << m_first_minimum_pool_allocation_size
+                        << ", next_minimum_pool_allocation_size=" << m_next_minimum_pool_allocation_size
+                        << ", alignment=" << alignment << " )");
+
+  m_instance_id = ThreadHeaps::add(this);
+}
+
+ThreadHeapPool::~ThreadHeapPool()
+{
+  ThreadHeaps::remove(m_instance_id);
+
+  //
+  // Return blocks that were freed remotely, so that the heaps can release
+  // their memory when they are destroyed
+  //
+  for (auto& heap : m_heaps) {
+    drainRemote(heap.get());
+  }
+}
+
+void* ThreadHeapPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  Heap* heap{getThreadHeap()};
+  drainRemote(heap);
+
+  char* base{static_cast<char*>(allocateFromHeap(heap, m_header_size + bytes))};
+
+  BlockHeader* header{reinterpret_cast<BlockHeader*>(base)};
+  header->owner = heap;
+  header->next = nullptr;
+
+  return base + m_header_size;
+}
+
+void ThreadHeapPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  BlockHeader* header{reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) - m_header_size)};
+  Heap* owner{header->owner};
+
+  if (owner == ThreadHeaps::find(m_instance_id)) {
+    owner->pool.deallocate(header, 0);
+  } else {
+    owner->remote.push(header);
+  }
+}
+
+void ThreadHeapPool::release()
+{
+  UMPIRE_LOG(Debug, "()");
+
+  Heap* heap{ThreadHeaps::find(m_instance_id)};
+  if (heap) {
+    drainRemote(heap);
+
+    std::lock_guard<std::mutex> lock(m_global_mutex);
+    heap->pool.release();
+    heap->actual_size.store(heap->pool.getActualSize(), std::memory_order_relaxed);
+  }
+}
+
+std::size_t ThreadHeapPool::getActualSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_heaps_mutex);
+
+  std::size_t actual_size{0};
+  for (auto& heap : m_heaps) {
+    actual_size += heap->actual_size.load(std::memory_order_relaxed);
+  }
+  return actual_size;
+}
+
+Platform ThreadHeapPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits ThreadHeapPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+std::size_t ThreadHeapPool::getNumHeaps() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_heaps_mutex);
+  return m_heaps.size();
+}
+
+ThreadHeapPool::Heap* ThreadHeapPool::getThreadHeap()
+{
+  Heap* heap{ThreadHeaps::find(m_instance_id)};
+
+  if (heap == nullptr) {
+    std::lock_guard<std::mutex> lock(m_heaps_mutex);
+
+    for (auto& candidate : m_heaps) {
+      bool abandoned{true};
+      if (candidate->abandoned.compare_exchange_strong(abandoned, false, std::memory_order_acquire)) {
+        UMPIRE_LOG(Debug, "Adopting abandoned heap " << candidate.get());
+        heap = candidate.get();
+        break;
+      }
+    }
+
+    if (heap == nullptr) {
+      const std::string heap_name{getName() + "_heap_" + std::to_string(m_heaps.size())};
+      m_heaps.emplace_back(new Heap{heap_name, getId(), m_parent, m_first_minimum_pool_allocation_size,
+                                    m_next_minimum_pool_allocation_size, m_alignment});
+      heap = m_heaps.back().get();
+      UMPIRE_LOG(Debug, "Created heap " << heap);
+    }
+
+    ThreadHeaps::insert(m_instance_id, heap);
+  }
+
+  return heap;
+}
+
+void ThreadHeapPool::retire(Heap* heap)
+{
+  UMPIRE_LOG(Debug, "Abandoning heap " << heap);
+
+  drainRemote(heap);
+  heap->abandoned.store(true, std::memory_order_release);
+}
+
+void ThreadHeapPool::drainRemote(Heap* heap)
+{
+  BlockHeader* header{heap->remote.take_all()};
+
+  while (header) {
+    BlockHeader* next{header->next};
+    heap->pool.deallocate(header, 0);
+    header = next;
+  }
+}
+
+void* ThreadHeapPool::allocateFromHeap(Heap* heap, std::size_t bytes)
+{
+  const std::size_t rounded_bytes{bytes + (m_alignment - 1) - (bytes - 1) % m_alignment};
+
+  //
+  // Only lock the underlying allocator if the heap is going to grow
+  //
+  if (heap->pool.getLargestAvailableBlock() >= rounded_bytes) {
+    return heap->pool.allocate(bytes);
+  }
+
+  std::lock_guard<std::mutex> lock(m_global_mutex);
+  void* ptr{heap->pool.allocate(bytes)};
+  heap->actual_size.store(heap->pool.getActualSize(), std::memory_order_relaxed);
+  return ptr;
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_ThreadHeapPool_HPP
+#define UMPIRE_ThreadHeapPool_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/util/RemoteFreeList.hpp"
+#include "umpire/util/ThreadRegistry.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief Thread-safe pool made of one QuickPool heap per thread.
+ *
+ * Each thread allocates from its own heap without locking; the underlying
+ * allocator is only locked when a heap has to grow. Every block is tagged
+ * with the heap it came from. Freeing a block on the thread that owns its
+ * heap returns it to the heap directly, while freeing it on any other thread
+ * pushes it onto a lock-free remote free list of the owning heap. The owner
+ * drains that list on its next allocation, so blocks allocated on one thread
+ * and freed on another never take a lock.
+ *
+ * The heap of an exiting thread is abandoned and adopted by the next thread
+ * that needs a heap, along with any blocks freed to it in the meantime.
+ */
+class ThreadHeapPool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_first_block_size{4 * 1024 * 1024};
+  static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
+  static constexpr std::size_t s_default_alignment{16};
+
+  /*!
+   * \brief Construct a new ThreadHeapPool.
+   *
+   * \param name Name of this instance of the ThreadHeapPool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that pool uses, must be host
+   * accessible
+   * \param first_minimum_pool_allocation_size Size each heap initially
+   * allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * allocations of a heap
+   * \param alignment Number of bytes with which to align allocations
+   * (power-of-2)
+   */
+  ThreadHeapPool(const std::string& name, int id, Allocator allocator,
+                 const std::size_t first_minimum_pool_allocation_size = s_default_first_block_size,
+                 const std::size_t next_minimum_pool_allocation_size = s_default_next_block_size,
+                 const std::size_t alignment = s_default_alignment);
+
+  ~ThreadHeapPool();
+
+  ThreadHeapPool(const ThreadHeapPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  /*!
+   * \brief Release the free blocks of the calling thread's heap.
+   *
+   * Heaps of other threads are left alone, since only their owner may use
+   * them.
+   */
+  void release() override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  /*!
+   * \brief Return the number of heaps created by the pool.
+   */
+  std::size_t getNumHeaps() const noexcept;
+
+ private:
+  struct Heap;
+
+  //
+  // Every block is preceded by a header holding the heap that owns it. The
+  // next pointer is only used while the block is on a remote free list.
+  //
+  struct BlockHeader {
+    Heap* owner;
+    BlockHeader* next;
+  };
+
+  struct Heap {
+    Heap(const std::string& name, int id, Allocator allocator, std::size_t first_minimum_pool_allocation_size,
+         std::size_t next_minimum_pool_allocation_size, std::size_t alignment);
+
+    QuickPool pool;
+    util::RemoteFreeList<BlockHeader> remote;
+    std::atomic<bool> abandoned{false};
+
+    // Copy of pool.getActualSize(), updated by the owning thread whenever the
+    // pool grows or releases memory, so other threads can read it
+    std::atomic<std::size_t> actual_size{0};
+  };
+
+  using ThreadHeaps = util::ThreadRegistry<ThreadHeapPool, Heap>;
+  friend ThreadHeaps;
+
+  Heap* getThreadHeap();
+  void retire(Heap* heap);
+  void drainRemote(Heap* heap);
+
+  void* allocateFromHeap(Heap* heap, std::size_t bytes);
+
+  Allocator m_parent;
+  strategy::AllocationStrategy* m_allocator;
+
+  const std::size_t m_first_minimum_pool_allocation_size;
+  const std::size_t m_next_minimum_pool_allocation_size;
+  const std::size_t m_alignment;
+  const std::size_t m_header_size;
+
+  std::uint64_t m_instance_id{0};
+
+  mutable std::mutex m_heaps_mutex;
+  std::vector<std::unique_ptr<Heap>> m_heaps;
+
+  // Serializes every use of the underlying allocator
+  mutable std::mutex m_global_mutex;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_ThreadHeapPool_HPP
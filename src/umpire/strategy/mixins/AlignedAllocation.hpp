@@ -40,6 +40,17 @@ public:
     //!
     void aligned_deallocate(void* ptr);
 
+    //!
+    //! \returns The configured alignment
+    //!
+    std::size_t getAlignment() const noexcept;
+
+    //!
+    //! \returns Number of bytes from ptr to the next multiple of alignment,
+    //!          which must be a power of 2
+    //!
+    static std::size_t aligned_padding(const void* ptr, std::size_t alignment) noexcept;
+
 protected:
     strategy::AllocationStrategy* m_allocator;
 
@@ -46,6 +46,17 @@ inline void AlignedAllocation::aligned_deallocate(void* ptr)
   m_allocator->deallocate_internal(buffer, size);
 }
 
+inline std::size_t AlignedAllocation::getAlignment() const noexcept
+{
+  return m_alignment;
+}
+
+inline std::size_t AlignedAllocation::aligned_padding(const void* ptr, std::size_t alignment) noexcept
+{
+  const uintptr_t address{ reinterpret_cast<uintptr_t>(ptr) };
+  return static_cast<std::size_t>(((address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - address);
+}
+
 } // namespace mixins
 } // namespace strategy
 } // namespace umpire
@@ -41,7 +41,10 @@ void Inspector::registerAllocation(void* ptr, std::size_t size, strategy::Alloca
 util::AllocationRecord
 Inspector::deregisterAllocation(void* ptr, strategy::AllocationStrategy* s)
 {
-  auto record = ResourceManager::getInstance().deregisterAllocation(ptr);
+  util::AllocationRecord record;
+  if (!(s->ownsAllocationRecords() && s->removeAllocationRecord(ptr, &record))) {
+    record = ResourceManager::getInstance().deregisterAllocation(ptr);
+  }
 
   if (record.strategy == s) {
     s->m_current_size -= record.size;
@@ -55,6 +58,51 @@ Inspector::deregisterAllocation(void* ptr, strategy::AllocationStrategy* s)
   return record;
 }
 
+void Inspector::deregisterAllocation(void* ptr, std::size_t size, strategy::AllocationStrategy* s)
+{
+  if (!(s->ownsAllocationRecords() && s->removeAllocationRecord(ptr, nullptr))) {
+    ResourceManager::getInstance().eraseAllocation(ptr);
+  }
+
+  s->m_current_size -= size;
+  s->m_allocation_count--;
+}
+
+void Inspector::registerAllocations(void* const* ptrs, std::size_t count, std::size_t size,
+                                    strategy::AllocationStrategy* s)
+{
+  s->m_current_size += count * size;
+  s->m_allocation_count += count;
+
+  if (s->m_current_size > s->m_high_watermark) {
+    s->m_high_watermark = s->m_current_size;
+  }
+
+  ResourceManager::getInstance().registerAllocations(ptrs, count, {nullptr, size, s});
+}
+
+void Inspector::deregisterAllocations(void* const* ptrs, std::size_t count, strategy::AllocationStrategy* s,
+                                      util::AllocationRecord* records)
+{
+  auto& rm = ResourceManager::getInstance();
+  rm.deregisterAllocations(ptrs, count, records);
+
+  std::size_t size{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (records[i].strategy != s) {
+      // Re-register the pointers and throw an error
+      for (std::size_t j = 0; j < count; ++j) {
+        rm.registerAllocation(ptrs[j], records[j]);
+      }
+      UMPIRE_ERROR(ptrs[i] << " was not allocated by " << s->getName());
+    }
+    size += records[i].size;
+  }
+
+  s->m_current_size -= size;
+  s->m_allocation_count -= count;
+}
+
 } // end of namespace mixins
 } // end of namespace strategy
 } // end of namespace umpire
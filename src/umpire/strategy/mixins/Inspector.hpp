@@ -30,6 +30,18 @@ class Inspector
 
     // Deregisters the allocation if the strategy matches, otherwise throws an error
     util::AllocationRecord deregisterAllocation(void* ptr, strategy::AllocationStrategy* strategy);
+
+    // Deregisters an allocation of size bytes, trusting the caller for the
+    // size and the strategy rather than checking them against the record
+    void deregisterAllocation(void* ptr, std::size_t size, strategy::AllocationStrategy* strategy);
+
+    void registerAllocations(void* const* ptrs, std::size_t count, std::size_t size,
+                             strategy::AllocationStrategy* strategy);
+
+    // Deregisters all the allocations if the strategy matches for each of them,
+    // otherwise throws an error and leaves them all registered
+    void deregisterAllocations(void* const* ptrs, std::size_t count, strategy::AllocationStrategy* strategy,
+                               util::AllocationRecord* records);
 };
 
 } // end of namespace mixins
@@ -0,0 +1,179 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/AddressRangeIndex.hpp"
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+constexpr std::size_t s_initial_capacity{64};
+
+} // namespace
+
+AddressRangeIndex::AddressRangeIndex()
+{
+  m_tables.emplace_back(new Table{s_initial_capacity});
+  m_table.store(m_tables.back().get(), std::memory_order_release);
+}
+
+bool AddressRangeIndex::insert(void* ptr, std::size_t size, strategy::AllocationStrategy* owner)
+{
+  const std::uintptr_t begin{reinterpret_cast<std::uintptr_t>(ptr)};
+  const std::uintptr_t end{begin + size};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Table* table{m_table.load(std::memory_order_relaxed)};
+  const std::size_t count{m_size.load(std::memory_order_relaxed)};
+  const std::size_t position{lowerBound(table, count, begin)};
+
+  if ((position < count && table->ranges[position].begin.load(std::memory_order_relaxed) < end) ||
+      (position > 0 && table->ranges[position - 1].end.load(std::memory_order_relaxed) > begin)) {
+    UMPIRE_LOG(Debug, "Range " << ptr << " -- " << reinterpret_cast<void*>(end) << " overlaps a range already indexed");
+    return false;
+  }
+
+  if (count == table->capacity) {
+    // Fill a larger table before publishing it, so lookups see either one
+    Table* larger{new Table{2 * table->capacity}};
+    m_tables.emplace_back(larger);
+
+    for (std::size_t i = 0; i < position; ++i) {
+      copy(larger->ranges[i], table->ranges[i]);
+    }
+    for (std::size_t i = position; i < count; ++i) {
+      copy(larger->ranges[i + 1], table->ranges[i]);
+    }
+
+    Range& range{larger->ranges[position]};
+    range.begin.store(begin, std::memory_order_relaxed);
+    range.end.store(end, std::memory_order_relaxed);
+    range.owner.store(owner, std::memory_order_relaxed);
+
+    beginUpdate();
+    m_table.store(larger, std::memory_order_relaxed);
+    m_size.store(count + 1, std::memory_order_relaxed);
+    endUpdate();
+  } else {
+    beginUpdate();
+    for (std::size_t i = count; i > position; --i) {
+      copy(table->ranges[i], table->ranges[i - 1]);
+    }
+
+    Range& range{table->ranges[position]};
+    range.begin.store(begin, std::memory_order_relaxed);
+    range.end.store(end, std::memory_order_relaxed);
+    range.owner.store(owner, std::memory_order_relaxed);
+
+    m_size.store(count + 1, std::memory_order_relaxed);
+    endUpdate();
+  }
+
+  return true;
+}
+
+void AddressRangeIndex::remove(void* ptr)
+{
+  const std::uintptr_t begin{reinterpret_cast<std::uintptr_t>(ptr)};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Table* table{m_table.load(std::memory_order_relaxed)};
+  const std::size_t count{m_size.load(std::memory_order_relaxed)};
+  const std::size_t position{lowerBound(table, count, begin)};
+
+  if (position == count || table->ranges[position].begin.load(std::memory_order_relaxed) != begin) {
+    UMPIRE_ERROR("No range starting at " << ptr << " is indexed");
+  }
+
+  beginUpdate();
+  for (std::size_t i = position; i + 1 < count; ++i) {
+    copy(table->ranges[i], table->ranges[i + 1]);
+  }
+  m_size.store(count - 1, std::memory_order_relaxed);
+  endUpdate();
+}
+
+strategy::AllocationStrategy* AddressRangeIndex::find(void* ptr) const noexcept
+{
+  const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(ptr)};
+
+  while (true) {
+    const std::size_t sequence{m_sequence.load(std::memory_order_acquire)};
+    if (sequence & 1) {
+      continue;
+    }
+
+    const Table* table{m_table.load(std::memory_order_relaxed)};
+    std::size_t count{m_size.load(std::memory_order_relaxed)};
+    // A torn read of an update in progress is retried below, but must not
+    // run off the end of the table meanwhile
+    if (count > table->capacity) {
+      count = table->capacity;
+    }
+
+    strategy::AllocationStrategy* owner{nullptr};
+
+    // Find the last range beginning at or before address
+    const std::size_t position{lowerBound(table, count, address + 1)};
+    if (position > 0) {
+      const Range& range{table->ranges[position - 1]};
+      if (address < range.end.load(std::memory_order_relaxed)) {
+        owner = range.owner.load(std::memory_order_relaxed);
+      }
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+      return owner;
+    }
+  }
+}
+
+std::size_t AddressRangeIndex::size() const noexcept
+{
+  return m_size.load(std::memory_order_relaxed);
+}
+
+std::size_t AddressRangeIndex::lowerBound(const Table* table, std::size_t size, std::uintptr_t address) noexcept
+{
+  std::size_t first{0};
+  while (size > 0) {
+    const std::size_t half{size / 2};
+    if (table->ranges[first + half].begin.load(std::memory_order_relaxed) < address) {
+      first += half + 1;
+      size -= half + 1;
+    } else {
+      size = half;
+    }
+  }
+  return first;
+}
+
+void AddressRangeIndex::copy(Range& to, const Range& from) noexcept
+{
+  to.begin.store(from.begin.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  to.end.store(from.end.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  to.owner.store(from.owner.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void AddressRangeIndex::beginUpdate() noexcept
+{
+  m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void AddressRangeIndex::endUpdate() noexcept
+{
+  m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // end namespace util
+} // end namespace umpire
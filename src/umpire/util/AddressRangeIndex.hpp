@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AddressRangeIndex_HPP
+#define UMPIRE_AddressRangeIndex_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace umpire {
+
+namespace strategy {
+class AllocationStrategy;
+}
+
+namespace util {
+
+/*!
+ * \brief Index of non-overlapping address ranges, each owned by an
+ * AllocationStrategy.
+ *
+ * The ranges are kept in an array sorted by address, so finding the owner of
+ * an address is a binary search. Updates are serialized by a mutex and
+ * published through a sequence counter, so lookups never take a lock: they
+ * search the array and retry in the rare case that an update happened
+ * meanwhile.
+ */
+class AddressRangeIndex {
+ public:
+  AddressRangeIndex();
+
+  AddressRangeIndex(const AddressRangeIndex&) = delete;
+  AddressRangeIndex& operator=(const AddressRangeIndex&) = delete;
+
+  // Add the range of size bytes at ptr. Returns false, leaving the index
+  // unchanged, if it overlaps another range.
+  bool insert(void* ptr, std::size_t size, strategy::AllocationStrategy* owner);
+
+  // Remove the range starting at ptr. Throws if there is none.
+  void remove(void* ptr);
+
+  // Find the owner of the range containing ptr, or nullptr if there is none
+  strategy::AllocationStrategy* find(void* ptr) const noexcept;
+
+  std::size_t size() const noexcept;
+
+ private:
+  struct Range {
+    std::atomic<std::uintptr_t> begin{0};
+    std::atomic<std::uintptr_t> end{0};
+    std::atomic<strategy::AllocationStrategy*> owner{nullptr};
+  };
+
+  struct Table {
+    explicit Table(std::size_t c) : capacity{c}, ranges{new Range[c]}
+    {
+    }
+
+    const std::size_t capacity;
+    std::unique_ptr<Range[]> ranges;
+  };
+
+  // Index of the first range in table that begins at or after address
+  static std::size_t lowerBound(const Table* table, std::size_t size, std::uintptr_t address) noexcept;
+  static void copy(Range& to, const Range& from) noexcept;
+
+  void beginUpdate() noexcept;
+  void endUpdate() noexcept;
+
+  std::mutex m_mutex;
+  std::atomic<std::size_t> m_sequence{0};
+  std::atomic<Table*> m_table{nullptr};
+  std::atomic<std::size_t> m_size{0};
+
+  // Lookups may still be searching a table that has been outgrown, so all of
+  // them are kept until the index is destroyed
+  std::vector<std::unique_ptr<Table>> m_tables;
+};
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_AddressRangeIndex_HPP
@@ -54,6 +54,17 @@ AllocationRecord AllocationMap::RecordList::pop_back()
   }
 
   const AllocationRecord ret = m_tail->rec;
+  erase_back();
+
+  return ret;
+}
+
+void AllocationMap::RecordList::erase_back()
+{
+  if (m_length == 0) {
+    UMPIRE_ERROR("erase_back() called, but m_length == 0");
+  }
+
   RecordBlock* prev = m_tail->prev;
 
   // Deallocate and move tail pointer
@@ -63,8 +74,6 @@ AllocationRecord AllocationMap::RecordList::pop_back()
 
   // Reduce size
   m_length--;
-
-  return ret;
 }
 
 AllocationMap::RecordList::ConstIterator AllocationMap::RecordList::begin() const
@@ -154,9 +163,23 @@ AllocationMap::AllocationMap() : m_block_pool{sizeof(RecordList::RecordBlock)},
 }
 
 void AllocationMap::insert(void* ptr, AllocationRecord record)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  doInsert(ptr, record);
+}
+
+void AllocationMap::insert(void* const* ptrs, std::size_t count, AllocationRecord record)
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  for (std::size_t i = 0; i < count; ++i) {
+    record.ptr = ptrs[i];
+    doInsert(ptrs[i], record);
+  }
+}
+
+void AllocationMap::doInsert(void* ptr, const AllocationRecord& record)
+{
   UMPIRE_LOG(Debug, "Inserting " << ptr);
   UMPIRE_REPLAY("\"event\": \"allocation_map_insert\", \"payload\": { \"ptr\": \""
                 << ptr << "\", \"record_ptr\": \"" << record.ptr << "\", \"record_size\": \"" << record.size
@@ -266,6 +289,51 @@ AllocationRecord AllocationMap::remove(void* ptr)
   return ret;
 }
 
+void AllocationMap::erase(void* ptr)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  UMPIRE_LOG(Debug, "Erasing " << ptr);
+  UMPIRE_REPLAY("\"event\": \"allocation_map_remove\", \"payload\": { \"ptr\": \"" << ptr << "\" }");
+
+  auto iter = m_map.find(ptr);
+
+  if (iter->second) {
+    iter->second->erase_back();
+    if (iter->second->empty())
+      m_map.removeLast();
+  } else {
+    UMPIRE_ERROR("Cannot remove " << ptr);
+  }
+
+  --m_size;
+}
+
+void AllocationMap::remove(void* const* ptrs, std::size_t count, AllocationRecord* records)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    UMPIRE_LOG(Debug, "Removing " << ptrs[i]);
+    UMPIRE_REPLAY("\"event\": \"allocation_map_remove\", \"payload\": { \"ptr\": \"" << ptrs[i] << "\" }");
+
+    auto iter = m_map.find(ptrs[i]);
+
+    if (iter->second) {
+      records[i] = iter->second->pop_back();
+      if (iter->second->empty())
+        m_map.removeLast();
+      --m_size;
+    } else {
+      // Put back what was removed so far
+      for (std::size_t j = i; j > 0; --j) {
+        doInsert(ptrs[j - 1], records[j - 1]);
+      }
+      UMPIRE_ERROR("Cannot remove " << ptrs[i]);
+    }
+  }
+}
+
 bool AllocationMap::contains(void* ptr) const
 {
   UMPIRE_LOG(Debug, "Searching for " << ptr);
@@ -299,14 +367,7 @@ void AllocationMap::print(const std::function<bool(const AllocationRecord&)>&& p
     while (iter != end) {
       if (pred(*iter)) {
         any_match = true;
-        auto end_ptr = static_cast<unsigned char*>(iter->ptr) + iter->size;
-        ss << "  size: " << iter->size << ", "
-           << "range: " << reinterpret_cast<void*>(iter->ptr) << " -- " << reinterpret_cast<void*>(end_ptr) << ", "
-           << "name: " << iter->name << ", "
-#if defined(UMPIRE_ENABLE_BACKTRACE)
-           << "backtrace: " << umpire::util::backtracer<trace_optional>::print(iter->allocation_backtrace)
-#endif // UMPIRE_ENABLE_BACKTRACE
-           << std::endl;
+        printRecord(*iter, ss);
       }
       ++iter;
     }
@@ -318,6 +379,18 @@ void AllocationMap::print(const std::function<bool(const AllocationRecord&)>&& p
   }
 }
 
+void AllocationMap::printRecord(const AllocationRecord& record, std::ostream& os)
+{
+  auto end_ptr = static_cast<unsigned char*>(record.ptr) + record.size;
+  os << "  size: " << record.size << ", "
+     << "range: " << reinterpret_cast<void*>(record.ptr) << " -- " << reinterpret_cast<void*>(end_ptr) << ", "
+     << "name: " << record.name << ", "
+#if defined(UMPIRE_ENABLE_BACKTRACE)
+     << "backtrace: " << umpire::util::backtracer<trace_optional>::print(record.allocation_backtrace)
+#endif // UMPIRE_ENABLE_BACKTRACE
+     << std::endl;
+}
+
 void AllocationMap::printAll(std::ostream& os) const
 {
   os << "🔍 Printing allocation map contents..." << std::endl;
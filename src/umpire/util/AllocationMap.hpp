@@ -65,6 +65,7 @@ class AllocationMap {
 
     void push_back(const AllocationRecord& rec);
     AllocationRecord pop_back();
+    void erase_back();
 
     ConstIterator begin() const;
     ConstIterator end() const;
@@ -124,6 +125,10 @@ class AllocationMap {
   // Insert a new record -- copies record
   void insert(void* ptr, AllocationRecord record);
 
+  // Insert a copy of record for each of count pointers, with its ptr set to
+  // that pointer, holding the lock once for all of them
+  void insert(void* const* ptrs, std::size_t count, AllocationRecord record);
+
   // Find a record -- throws an exception if the record is not found.
   // AllocationRecord addresses will not change once registered, so
   // the resulting address of a find(ptr) call can be stored
@@ -140,6 +145,14 @@ class AllocationMap {
   // Only allows erasing the last inserted entry for key = ptr
   AllocationRecord remove(void* ptr);
 
+  // Like remove, but drops the record instead of returning it
+  void erase(void* ptr);
+
+  // Remove the records of count pointers into records, holding the lock once
+  // for all of them. Throws, without removing any record, if one of the
+  // pointers is not found.
+  void remove(void* const* ptrs, std::size_t count, AllocationRecord* records);
+
   // Check if a pointer has been added to the map.
   bool contains(void* ptr) const;
 
@@ -154,6 +167,9 @@ class AllocationMap {
 
   void printAll(std::ostream& os = std::cout) const;
 
+  // Print a single record, in the format used by print
+  static void printRecord(const AllocationRecord& record, std::ostream& os);
+
   ConstIterator begin() const;
   ConstIterator end() const;
 
@@ -161,6 +177,9 @@ class AllocationMap {
   // Content of findRecord(void*) without the lock
   const AllocationRecord* doFindRecord(void* ptr) const noexcept;
 
+  // Content of insert(void*, AllocationRecord) without the lock
+  void doInsert(void* ptr, const AllocationRecord& record);
+
   // This block pool is used inside RecordList, but is needed here so its
   // destruction is linked to that of AllocationMap
   FixedMallocPool m_block_pool;
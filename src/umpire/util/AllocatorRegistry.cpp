@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/AllocatorRegistry.hpp"
+
+#include <thread>
+
+namespace umpire {
+namespace util {
+
+AllocatorRegistry::AllocatorRegistry() : m_snapshot{new Snapshot{}}
+{
+}
+
+AllocatorRegistry::~AllocatorRegistry()
+{
+  delete m_snapshot.load();
+}
+
+strategy::AllocationStrategy* AllocatorRegistry::find(const std::string& name) const noexcept
+{
+  ReadGuard guard{*this};
+
+  auto strategy = guard.snapshot()->names.find(name);
+  return (strategy == guard.snapshot()->names.end()) ? nullptr : strategy->second;
+}
+
+strategy::AllocationStrategy* AllocatorRegistry::find(int id) const noexcept
+{
+  ReadGuard guard{*this};
+
+  auto strategy = guard.snapshot()->ids.find(id);
+  return (strategy == guard.snapshot()->ids.end()) ? nullptr : strategy->second;
+}
+
+AllocatorRegistry::Snapshot AllocatorRegistry::copy() const
+{
+  ReadGuard guard{*this};
+  return *guard.snapshot();
+}
+
+void AllocatorRegistry::update(const std::function<void(Snapshot&)>& apply)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const Snapshot* previous{m_snapshot.load()};
+  Snapshot* next{new Snapshot{*previous}};
+
+  try {
+    apply(*next);
+  } catch (...) {
+    delete next;
+    throw;
+  }
+
+  m_snapshot.store(next);
+  m_version.fetch_add(1);
+
+  // Lookups that start from here on see next, so only those that announced
+  // themselves under the previous epoch can still be reading previous
+  const std::size_t parity{m_epoch.fetch_add(1) & 1};
+  for (auto& slot : m_slots) {
+    while (slot.readers[parity].load() != 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  delete previous;
+}
+
+std::size_t AllocatorRegistry::version() const noexcept
+{
+  return m_version.load(std::memory_order_acquire);
+}
+
+std::size_t AllocatorRegistry::slotIndex() noexcept
+{
+  static std::atomic<std::size_t> s_next_slot{0};
+  static thread_local const std::size_t s_slot{s_next_slot.fetch_add(1, std::memory_order_relaxed) % s_reader_slots};
+  return s_slot;
+}
+
+AllocatorRegistry::ReadGuard::ReadGuard(const AllocatorRegistry& registry) noexcept : m_registry{registry}
+{
+  ReaderSlot& slot = m_registry.m_slots[slotIndex()];
+
+  while (true) {
+    const std::size_t epoch{m_registry.m_epoch.load()};
+    m_readers = &slot.readers[epoch & 1];
+    m_readers->fetch_add(1);
+
+    // If the epoch moved on before we were counted, the update that moved it
+    // may not have seen us, so count ourselves under the new one instead
+    if (m_registry.m_epoch.load() == epoch) {
+      break;
+    }
+    m_readers->fetch_sub(1);
+  }
+
+  m_snapshot = m_registry.m_snapshot.load();
+}
+
+AllocatorRegistry::ReadGuard::~ReadGuard()
+{
+  m_readers->fetch_sub(1, std::memory_order_release);
+}
+
+const AllocatorRegistry::Snapshot* AllocatorRegistry::ReadGuard::snapshot() const noexcept
+{
+  return m_snapshot;
+}
+
+} // end namespace util
+} // end namespace umpire
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocatorRegistry_HPP
+#define UMPIRE_AllocatorRegistry_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace umpire {
+
+namespace strategy {
+class AllocationStrategy;
+}
+
+namespace util {
+
+/*!
+ * \brief Maps allocator names and ids to their AllocationStrategy.
+ *
+ * Lookups read an immutable snapshot of both maps without taking a lock.
+ * Updates copy the current snapshot, modify and publish the copy, and then
+ * wait for the readers of the previous snapshot to leave before freeing it.
+ * Readers announce themselves in one of two counters selected by the parity
+ * of the current epoch, so an update only waits for the lookups that started
+ * before it.
+ */
+class AllocatorRegistry {
+ public:
+  struct Snapshot {
+    std::unordered_map<std::string, strategy::AllocationStrategy*> names;
+    std::unordered_map<int, strategy::AllocationStrategy*> ids;
+  };
+
+  AllocatorRegistry();
+  ~AllocatorRegistry();
+
+  AllocatorRegistry(const AllocatorRegistry&) = delete;
+  AllocatorRegistry& operator=(const AllocatorRegistry&) = delete;
+
+  // Find the strategy registered under name or id, or nullptr if there is none
+  strategy::AllocationStrategy* find(const std::string& name) const noexcept;
+  strategy::AllocationStrategy* find(int id) const noexcept;
+
+  // Copy of the current snapshot
+  Snapshot copy() const;
+
+  /*!
+   * \brief Call apply on a copy of the current snapshot, then publish the copy.
+   *
+   * Must not be called from a thread that is inside a lookup.
+   */
+  void update(const std::function<void(Snapshot&)>& apply);
+
+  /*!
+   * \brief Number of updates published so far.
+   *
+   * Callers that cache the result of a lookup can compare this against the
+   * value read before the lookup to find out whether it may be stale.
+   */
+  std::size_t version() const noexcept;
+
+ private:
+  static constexpr std::size_t s_reader_slots{64};
+
+  // Padded to a cache line so that threads using different slots do not
+  // contend
+  struct ReaderSlot {
+    std::atomic<std::size_t> readers[2];
+    char padding[64 - 2 * sizeof(std::atomic<std::size_t>)];
+  };
+
+  class ReadGuard {
+   public:
+    explicit ReadGuard(const AllocatorRegistry& registry) noexcept;
+    ~ReadGuard();
+
+    const Snapshot* snapshot() const noexcept;
+
+   private:
+    const AllocatorRegistry& m_registry;
+    std::atomic<std::size_t>* m_readers;
+    const Snapshot* m_snapshot;
+  };
+
+  static std::size_t slotIndex() noexcept;
+
+  std::mutex m_mutex;
+  std::atomic<const Snapshot*> m_snapshot;
+  std::atomic<std::size_t> m_epoch{0};
+  std::atomic<std::size_t> m_version{0};
+  mutable ReaderSlot m_slots[s_reader_slots]{};
+};
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_AllocatorRegistry_HPP
@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/MagazineCache.hpp"
+
+#include <utility>
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace util {
+
+MagazineCache::Magazine::Magazine(std::size_t capacity) : objects{new void*[capacity]}
+{
+}
+
+MagazineCache::ThreadMagazines::ThreadMagazines(std::size_t num_classes) : racks(num_classes)
+{
+}
+
+MagazineCache::MagazineCache(std::size_t num_classes, std::size_t magazine_size, std::size_t max_depot_magazines)
+    : m_num_classes{num_classes}, m_magazine_size{magazine_size}, m_max_depot_magazines{max_depot_magazines}
+{
+  if (m_magazine_size == 0) {
+    UMPIRE_ERROR("MagazineCache error: magazine_size must be greater than 0");
+  }
+
+  for (std::size_t i = 0; i < m_num_classes; i++) {
+    m_depots.emplace_back(new Depot{});
+  }
+
+  m_instance_id = ThreadRacks::add(this);
+}
+
+MagazineCache::~MagazineCache()
+{
+  ThreadRacks::remove(m_instance_id);
+}
+
+void* MagazineCache::pop(std::size_t size_class)
+{
+  Rack& rack{getThreadMagazines()->racks[size_class]};
+
+  if (!rack.loaded || rack.loaded->rounds == 0) {
+    if (rack.previous && rack.previous->rounds != 0) {
+      std::swap(rack.loaded, rack.previous);
+    } else {
+      Depot& depot{*m_depots[size_class]};
+      std::lock_guard<std::mutex> lock(depot.mutex);
+
+      if (!depot.full) {
+        return nullptr;
+      }
+
+      Magazine* full{depot.full};
+      depot.full = full->next;
+      depot.num_full--;
+
+      if (rack.previous) {
+        deposit(depot, rack.previous);
+      }
+      rack.previous = rack.loaded;
+      rack.loaded = full;
+    }
+  }
+
+  return rack.loaded->objects[--rack.loaded->rounds];
+}
+
+bool MagazineCache::push(std::size_t size_class, void* ptr)
+{
+  Rack& rack{getThreadMagazines()->racks[size_class]};
+
+  if (!rack.loaded || rack.loaded->rounds == m_magazine_size) {
+    if (rack.previous && rack.previous->rounds != m_magazine_size) {
+      std::swap(rack.loaded, rack.previous);
+    } else {
+      Depot& depot{*m_depots[size_class]};
+      std::unique_lock<std::mutex> lock(depot.mutex);
+
+      if (rack.previous && depot.num_full >= m_max_depot_magazines) {
+        return false;
+      }
+
+      Magazine* empty{depot.empty};
+      if (empty) {
+        depot.empty = empty->next;
+      } else {
+        lock.unlock();
+        {
+          std::lock_guard<std::mutex> magazines_lock(m_magazines_mutex);
+          m_magazines.emplace_back(new Magazine{m_magazine_size});
+          empty = m_magazines.back().get();
+        }
+        lock.lock();
+
+        if (rack.previous && depot.num_full >= m_max_depot_magazines) {
+          deposit(depot, empty);
+          return false;
+        }
+      }
+
+      if (rack.previous) {
+        deposit(depot, rack.previous);
+      }
+      rack.previous = rack.loaded;
+      rack.loaded = empty;
+    }
+  }
+
+  rack.loaded->objects[rack.loaded->rounds++] = ptr;
+  return true;
+}
+
+void MagazineCache::release(const Release& release)
+{
+  for (std::size_t size_class = 0; size_class < m_num_classes; size_class++) {
+    Depot& depot{*m_depots[size_class]};
+    Magazine* full{nullptr};
+
+    {
+      std::lock_guard<std::mutex> lock(depot.mutex);
+      full = depot.full;
+      depot.full = nullptr;
+      depot.num_full = 0;
+    }
+
+    while (full) {
+      Magazine* next{full->next};
+      releaseMagazine(size_class, full, release);
+
+      std::lock_guard<std::mutex> lock(depot.mutex);
+      deposit(depot, full);
+      full = next;
+    }
+  }
+}
+
+void MagazineCache::releaseAll(const Release& release)
+{
+  {
+    std::lock_guard<std::mutex> magazines_lock(m_magazines_mutex);
+    for (auto& magazines : m_thread_magazines) {
+      for (std::size_t size_class = 0; size_class < m_num_classes; size_class++) {
+        std::lock_guard<std::mutex> lock(m_depots[size_class]->mutex);
+        Rack& rack{magazines->racks[size_class]};
+        if (rack.loaded) {
+          releaseMagazine(size_class, rack.loaded, release);
+        }
+        if (rack.previous) {
+          releaseMagazine(size_class, rack.previous, release);
+        }
+      }
+    }
+  }
+
+  this->release(release);
+}
+
+std::size_t MagazineCache::getNumClasses() const noexcept
+{
+  return m_num_classes;
+}
+
+MagazineCache::ThreadMagazines* MagazineCache::getThreadMagazines()
+{
+  ThreadMagazines* magazines{ThreadRacks::find(m_instance_id)};
+
+  if (magazines == nullptr) {
+    {
+      std::lock_guard<std::mutex> lock(m_magazines_mutex);
+      m_thread_magazines.emplace_back(new ThreadMagazines{m_num_classes});
+      magazines = m_thread_magazines.back().get();
+    }
+
+    ThreadRacks::insert(m_instance_id, magazines);
+  }
+
+  return magazines;
+}
+
+void MagazineCache::retire(ThreadMagazines* magazines)
+{
+  UMPIRE_LOG(Debug, "Retiring thread magazines " << magazines);
+
+  for (std::size_t size_class = 0; size_class < m_num_classes; size_class++) {
+    Depot& depot{*m_depots[size_class]};
+    std::lock_guard<std::mutex> lock(depot.mutex);
+
+    Rack& rack{magazines->racks[size_class]};
+    if (rack.loaded) {
+      deposit(depot, rack.loaded);
+    }
+    if (rack.previous) {
+      deposit(depot, rack.previous);
+    }
+    rack.loaded = rack.previous = nullptr;
+  }
+}
+
+void MagazineCache::deposit(Depot& depot, Magazine* magazine) noexcept
+{
+  if (magazine->rounds == 0) {
+    magazine->next = depot.empty;
+    depot.empty = magazine;
+  } else {
+    magazine->next = depot.full;
+    depot.full = magazine;
+    depot.num_full++;
+  }
+}
+
+void MagazineCache::releaseMagazine(std::size_t size_class, Magazine* magazine, const Release& release)
+{
+  while (magazine->rounds != 0) {
+    release(size_class, magazine->objects[--magazine->rounds]);
+  }
+}
+
+} // end namespace util
+} // end namespace umpire
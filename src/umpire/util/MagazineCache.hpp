@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_MagazineCache_HPP
+#define UMPIRE_MagazineCache_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "umpire/util/ThreadRegistry.hpp"
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Per-thread caches of free objects in front of a pool, after the
+ * magazine and depot layers of Bonwick and Adams' vmem and libumem.
+ *
+ * Objects belong to one of a fixed number of size classes. For each class,
+ * every thread holds two magazines: arrays of up to magazine_size free
+ * objects that it pops from and pushes to without locking. When both are
+ * empty (on pop) or both are full (on push), the thread exchanges one for a
+ * full or an empty magazine from the depot of that class, which is guarded by
+ * a mutex. A miss in the depot is left to the caller, which then allocates
+ * from or frees to the pool behind the cache.
+ *
+ * The depot of each class holds at most max_depot_magazines full magazines,
+ * so that the memory cached stays bounded. The magazines of a thread that
+ * exits are moved to the depot.
+ */
+class MagazineCache {
+ public:
+  using Release = std::function<void(std::size_t size_class, void* ptr)>;
+
+  MagazineCache(std::size_t num_classes, std::size_t magazine_size, std::size_t max_depot_magazines);
+  ~MagazineCache();
+
+  MagazineCache(const MagazineCache&) = delete;
+  MagazineCache& operator=(const MagazineCache&) = delete;
+
+  /*!
+   * \brief Take a cached object of size_class, or return nullptr if the
+   * calling thread's magazines and the depot have none.
+   */
+  void* pop(std::size_t size_class);
+
+  /*!
+   * \brief Cache ptr as a free object of size_class.
+   *
+   * \return false if the depot is full, in which case the caller keeps ptr
+   */
+  bool push(std::size_t size_class, void* ptr);
+
+  /*!
+   * \brief Pass each object held in the depot to release.
+   */
+  void release(const Release& release);
+
+  /*!
+   * \brief Pass each object held in the depot and in the magazines of every
+   * thread to release.
+   *
+   * Only valid while no other thread is using the cache.
+   */
+  void releaseAll(const Release& release);
+
+  std::size_t getNumClasses() const noexcept;
+
+ private:
+  struct Magazine {
+    explicit Magazine(std::size_t capacity);
+
+    std::unique_ptr<void*[]> objects;
+    std::size_t rounds{0};
+    Magazine* next{nullptr};
+  };
+
+  // A thread's magazines of one class
+  struct Rack {
+    Magazine* loaded{nullptr};
+    Magazine* previous{nullptr};
+  };
+
+  struct ThreadMagazines {
+    explicit ThreadMagazines(std::size_t num_classes);
+
+    std::vector<Rack> racks;
+  };
+
+  struct Depot {
+    std::mutex mutex;
+    Magazine* full{nullptr};
+    Magazine* empty{nullptr};
+    std::size_t num_full{0};
+  };
+
+  using ThreadRacks = ThreadRegistry<MagazineCache, ThreadMagazines>;
+  friend ThreadRacks;
+
+  ThreadMagazines* getThreadMagazines();
+  void retire(ThreadMagazines* magazines);
+
+  // Move magazine to the full or empty list of depot. The depot's mutex
+  // must be held.
+  void deposit(Depot& depot, Magazine* magazine) noexcept;
+  void releaseMagazine(std::size_t size_class, Magazine* magazine, const Release& release);
+
+  const std::size_t m_num_classes;
+  const std::size_t m_magazine_size;
+  const std::size_t m_max_depot_magazines;
+
+  std::uint64_t m_instance_id{0};
+
+  std::vector<std::unique_ptr<Depot>> m_depots;
+
+  std::mutex m_magazines_mutex;
+  std::vector<std::unique_ptr<ThreadMagazines>> m_thread_magazines;
+  std::vector<std::unique_ptr<Magazine>> m_magazines;
+};
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_MagazineCache_HPP
@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_RemoteFreeList_HPP
+#define UMPIRE_RemoteFreeList_HPP
+
+#include <atomic>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Lock-free intrusive list that other threads push freed blocks onto.
+ *
+ * Any number of threads may push, and blocks are only ever removed all at
+ * once with take_all. Since nodes are never popped one by one, the list does
+ * not suffer from the ABA problem and take_all may also be called from any
+ * thread.
+ *
+ * Node must have a `Node* next` member.
+ */
+template <typename Node>
+class RemoteFreeList {
+ public:
+  void push(Node* node) noexcept
+  {
+    node->next = m_head.load(std::memory_order_relaxed);
+    while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  /*!
+   * \brief Remove every node from the list.
+   *
+   * \return The first node of the removed list, or nullptr if it was empty.
+   */
+  Node* take_all() noexcept
+  {
+    if (m_head.load(std::memory_order_relaxed) == nullptr) {
+      return nullptr;
+    }
+    return m_head.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  bool empty() const noexcept
+  {
+    return m_head.load(std::memory_order_relaxed) == nullptr;
+  }
+
+ private:
+  std::atomic<Node*> m_head{nullptr};
+};
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_RemoteFreeList_HPP
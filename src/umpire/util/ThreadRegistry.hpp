@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_ThreadRegistry_HPP
+#define UMPIRE_ThreadRegistry_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Per-thread lookup of the state (Local) that an Owner keeps for each
+ * thread that uses it.
+ *
+ * Owners register themselves with add and get a unique id back, which stays
+ * valid even if another Owner is later created at the same address. When a
+ * thread exits, Owner::retire(Local*) is called for each of its entries whose
+ * Owner has not been removed yet.
+ */
+template <typename Owner, typename Local>
+class ThreadRegistry {
+ public:
+  static std::uint64_t add(Owner* owner)
+  {
+    static std::atomic<std::uint64_t> s_next_id{1};
+    const std::uint64_t id{s_next_id++};
+
+    std::lock_guard<std::mutex> lock(mutex());
+    owners()[id] = owner;
+    return id;
+  }
+
+  static void remove(std::uint64_t id)
+  {
+    std::lock_guard<std::mutex> lock(mutex());
+    owners().erase(id);
+  }
+
+  /*!
+   * \brief Return the calling thread's entry for owner id, or nullptr.
+   */
+  static Local* find(std::uint64_t id) noexcept
+  {
+    return entries().find(id);
+  }
+
+  static void insert(std::uint64_t id, Local* local)
+  {
+    entries().insert(id, local);
+  }
+
+ private:
+  struct Entries {
+    ~Entries()
+    {
+      std::lock_guard<std::mutex> lock(mutex());
+      for (auto& entry : locals) {
+        auto owner = owners().find(entry.first);
+        if (owner != owners().end()) {
+          owner->second->retire(entry.second);
+        }
+      }
+    }
+
+    Local* find(std::uint64_t id) noexcept
+    {
+      if (last_id == id) {
+        return last_local;
+      }
+
+      for (auto& entry : locals) {
+        if (entry.first == id) {
+          last_id = entry.first;
+          last_local = entry.second;
+          return last_local;
+        }
+      }
+
+      return nullptr;
+    }
+
+    void insert(std::uint64_t id, Local* local)
+    {
+      locals.emplace_back(id, local);
+      last_id = id;
+      last_local = local;
+    }
+
+    std::uint64_t last_id{0};
+    Local* last_local{nullptr};
+    std::vector<std::pair<std::uint64_t, Local*>> locals;
+  };
+
+  static Entries& entries()
+  {
+    static thread_local Entries s_entries;
+    return s_entries;
+  }
+
+  //
+  // Owners may be destroyed after function-local statics, so these are never
+  // destroyed.
+  //
+  static std::mutex& mutex()
+  {
+    static std::mutex* s_mutex{new std::mutex};
+    return *s_mutex;
+  }
+
+  static std::unordered_map<std::uint64_t, Owner*>& owners()
+  {
+    static std::unordered_map<std::uint64_t, Owner*>* s_owners{new std::unordered_map<std::uint64_t, Owner*>};
+    return *s_owners;
+  }
+};
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_ThreadRegistry_HPP
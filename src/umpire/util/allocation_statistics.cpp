@@ -8,25 +8,49 @@
 #include "umpire/util/allocation_statistics.hpp"
 
 #include <algorithm>
-#include <limits> // for std::numeric_limits
+#include <iterator>
 
 namespace umpire {
 namespace util {
 
-float relative_fragmentation(std::vector<util::AllocationRecord>& recs)
+namespace {
+
+float relative_fragmentation(std::size_t largest_free_space, std::size_t total_free_space) noexcept
+{
+  // Without any free space there is nothing to fragment
+  if (total_free_space == 0) {
+    return 0.0f;
+  }
+
+  return 1.0f - static_cast<float>(largest_free_space) / static_cast<float>(total_free_space);
+}
+
+} // namespace
+
+float relative_fragmentation(const std::vector<util::AllocationRecord>& recs)
 {
-  auto r1 = recs.begin();
-  auto r2 = recs.begin();
-  ++r2;
   std::size_t largest_free_space = 0;
   std::size_t total_free_space = 0;
-  while (r2 != recs.end()) {
-    const std::size_t free_space = reinterpret_cast<char*>(r2->ptr) - (reinterpret_cast<char*>(r1->ptr) + r1->size);
-    largest_free_space = std::max(largest_free_space, free_space);
-    total_free_space += free_space;
+
+  if (recs.size() > 1) {
+    for (auto r1 = recs.begin(), r2 = std::next(r1); r2 != recs.end(); ++r1, ++r2) {
+      const char* r1_end{reinterpret_cast<const char*>(r1->ptr) + r1->size};
+      const char* r2_begin{reinterpret_cast<const char*>(r2->ptr)};
+
+      if (r2_begin > r1_end) {
+        const std::size_t free_space = r2_begin - r1_end;
+        largest_free_space = std::max(largest_free_space, free_space);
+        total_free_space += free_space;
+      }
+    }
   }
 
-  return 1.0f - static_cast<float>(largest_free_space) / (total_free_space + std::numeric_limits<float>::epsilon());
+  return relative_fragmentation(largest_free_space, total_free_space);
+}
+
+float relative_fragmentation(const FreeBlockStatistics& stats) noexcept
+{
+  return relative_fragmentation(stats.largest_free, stats.total_free);
 }
 
 } // namespace util
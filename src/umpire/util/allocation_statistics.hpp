@@ -7,6 +7,8 @@
 #ifndef UMPIRE_allocation_statistics_HPP
 #define UMPIRE_allocation_statistics_HPP
 
+#include <array>
+#include <cstddef>
 #include <vector>
 
 #include "umpire/util/AllocationRecord.hpp"
@@ -14,12 +16,70 @@
 namespace umpire {
 namespace util {
 
+/*!
+ * \brief Running statistics about the free blocks of a pool.
+ *
+ * Pools update these as free blocks are added, split and merged, so that
+ * they can be read at any time without walking the pool.
+ */
+struct FreeBlockStatistics {
+  static constexpr std::size_t s_num_bins{64};
+
+  /*!
+   * \brief Return the histogram bin for a free block of the given size,
+   * i.e. floor(log2(bytes)).
+   */
+  static std::size_t bin(std::size_t bytes) noexcept
+  {
+    std::size_t index{0};
+    while (bytes >>= 1) {
+      ++index;
+    }
+    return index;
+  }
+
+  void insert(std::size_t bytes) noexcept
+  {
+    total_free += bytes;
+    ++free_blocks;
+    ++histogram[bin(bytes)];
+  }
+
+  void erase(std::size_t bytes) noexcept
+  {
+    total_free -= bytes;
+    --free_blocks;
+    --histogram[bin(bytes)];
+  }
+
+  //! Size of the largest free block
+  std::size_t largest_free{0};
+
+  //! Sum of the sizes of all free blocks
+  std::size_t total_free{0};
+
+  //! Number of free blocks
+  std::size_t free_blocks{0};
+
+  //! Number of free blocks of size [2^i, 2^(i+1)) in bin i
+  std::array<std::size_t, s_num_bins> histogram{};
+};
+
 /*!
  * \brief Compute the relative fragmentation of a set of allocation records.
  *
+ * The records must be sorted by address, as returned by
+ * get_allocator_records, and the gaps between them are taken to be free.
+ *
  * Fragmentation = 1 - (largest free block) / (total free space)
  */
-float relative_fragmentation(std::vector<util::AllocationRecord>& recs);
+float relative_fragmentation(const std::vector<util::AllocationRecord>& recs);
+
+/*!
+ * \brief Compute the relative fragmentation of a pool from its free block
+ * statistics.
+ */
+float relative_fragmentation(const FreeBlockStatistics& stats) noexcept;
 
 } // namespace util
 } // namespace umpire
@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/pool_size_store.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+std::map<std::string, std::size_t> read_pool_sizes(const std::string& filename)
+{
+  std::map<std::string, std::size_t> sizes;
+  std::ifstream file{filename};
+  std::string line;
+
+  while (std::getline(file, line)) {
+    // Names may hold spaces, so split at the last tab
+    const auto tab = line.rfind('\t');
+    if (tab == std::string::npos || tab == 0) {
+      continue;
+    }
+
+    try {
+      sizes[line.substr(0, tab)] = std::stoull(line.substr(tab + 1));
+    } catch (...) {
+      UMPIRE_LOG(Warning, "Ignoring malformed line \"" << line << "\" in pool size file " << filename);
+    }
+  }
+
+  return sizes;
+}
+
+} // namespace
+
+std::size_t read_pool_size(const std::string& filename, const std::string& name) noexcept
+{
+  try {
+    const auto sizes = read_pool_sizes(filename);
+    const auto size = sizes.find(name);
+    return (size == sizes.end()) ? 0 : size->second;
+  } catch (...) {
+    UMPIRE_LOG(Warning, "Reading pool size file " << filename << " failed");
+    return 0;
+  }
+}
+
+void write_pool_size(const std::string& filename, const std::string& name, std::size_t size) noexcept
+{
+  try {
+    auto sizes = read_pool_sizes(filename);
+    sizes[name] = size;
+
+    const std::string temporary{filename + ".tmp"};
+    {
+      std::ofstream file{temporary, std::ios::trunc};
+      for (const auto& entry : sizes) {
+        file << entry.first << '\t' << entry.second << '\n';
+      }
+
+      if (!file) {
+        UMPIRE_LOG(Warning, "Writing pool size file " << temporary << " failed");
+        return;
+      }
+    }
+
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0) {
+      UMPIRE_LOG(Warning, "Renaming pool size file " << temporary << " to " << filename << " failed");
+    }
+  } catch (...) {
+    UMPIRE_LOG(Warning, "Writing pool size file " << filename << " failed");
+  }
+}
+
+} // end namespace util
+} // end namespace umpire
@@ -0,0 +1,39 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_pool_size_store_HPP
+#define UMPIRE_pool_size_store_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Read the size stored for the pool called name in filename.
+ *
+ * The file holds one line per pool, with the pool name and its size in bytes
+ * separated by a tab.
+ *
+ * \return The stored size, or 0 if the file or the pool is not found.
+ */
+std::size_t read_pool_size(const std::string& filename, const std::string& name) noexcept;
+
+/*!
+ * \brief Store size for the pool called name in filename, keeping the sizes
+ * of the other pools in the file.
+ *
+ * The file is rewritten to a temporary file that is then renamed over it, so
+ * readers never see a partially written file. Failures are logged and
+ * otherwise ignored.
+ */
+void write_pool_size(const std::string& filename, const std::string& name, std::size_t size) noexcept;
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_pool_size_store_HPP
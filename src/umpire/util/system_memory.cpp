@@ -0,0 +1,272 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/system_memory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "umpire/util/Macros.hpp"
+
+#if !defined(_MSC_VER)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+constexpr std::size_t s_unknown{std::numeric_limits<std::size_t>::max()};
+
+// Don't bother spreading less than this across threads
+constexpr std::size_t s_min_prefault_bytes_per_thread{64 * 1024 * 1024};
+
+//
+// Read a single value from a cgroup control file. Limits that are not set
+// are reported as "max" (v2) or as a huge number (v1), both of which are
+// treated as unknown.
+//
+std::size_t read_cgroup_value(const std::string& path)
+{
+  std::ifstream file{path};
+  std::string value;
+
+  if (!(file >> value) || value == "max") {
+    return s_unknown;
+  }
+
+  std::size_t bytes{0};
+  std::istringstream ss{value};
+  if (!(ss >> bytes)) {
+    return s_unknown;
+  }
+
+  return bytes;
+}
+
+std::size_t cgroup_headroom()
+{
+#if defined(_MSC_VER) || defined(__APPLE__)
+  return s_unknown;
+#else
+  std::ifstream cgroup{"/proc/self/cgroup"};
+  std::string line;
+  std::string v1_path;
+  std::string v2_path;
+
+  while (std::getline(cgroup, line)) {
+    // Lines are of the form "hierarchy-ID:controller-list:cgroup-path"
+    const auto first = line.find(':');
+    const auto second = line.find(':', first + 1);
+    if (first == std::string::npos || second == std::string::npos) {
+      continue;
+    }
+
+    const std::string controllers{line.substr(first + 1, second - first - 1)};
+    const std::string path{line.substr(second + 1)};
+
+    if (line.compare(0, first, "0") == 0 && controllers.empty()) {
+      v2_path = path;
+    } else if (controllers.find("memory") != std::string::npos) {
+      v1_path = path;
+    }
+  }
+
+  std::size_t limit{s_unknown};
+  std::size_t usage{s_unknown};
+
+  if (!v1_path.empty()) {
+    const std::string base{"/sys/fs/cgroup/memory" + v1_path};
+    limit = read_cgroup_value(base + "/memory.limit_in_bytes");
+    usage = read_cgroup_value(base + "/memory.usage_in_bytes");
+  } else {
+    const std::string base{"/sys/fs/cgroup" + v2_path};
+    limit = read_cgroup_value(base + "/memory.max");
+    usage = read_cgroup_value(base + "/memory.current");
+  }
+
+  // cgroup v1 reports an unset limit as a page-rounded LONG_MAX
+  if (limit == s_unknown || usage == s_unknown || limit >= static_cast<std::size_t>(1) << 62) {
+    return s_unknown;
+  }
+
+  return (limit > usage) ? limit - usage : 0;
+#endif
+}
+
+std::size_t meminfo_available()
+{
+#if defined(_MSC_VER) || defined(__APPLE__)
+  return s_unknown;
+#else
+  std::ifstream meminfo{"/proc/meminfo"};
+  std::string line;
+
+  while (std::getline(meminfo, line)) {
+    std::stringstream ss{line};
+    std::string key;
+    ss >> key;
+
+    if (key == "MemAvailable:") {
+      std::size_t available_kb;
+      if (ss >> available_kb) {
+        //
+        // "MemAvailable" is reported in kB. Convert this to number of bytes
+        //
+        return std::size_t{available_kb * 1024};
+      }
+    }
+  }
+
+  return s_unknown;
+#endif
+}
+
+#if !defined(_MSC_VER)
+std::uintptr_t page_size()
+{
+  static const std::uintptr_t s_page_size{static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE))};
+  return s_page_size;
+}
+#endif
+
+void prefault_range(char* begin, char* end)
+{
+#if defined(MADV_POPULATE_WRITE)
+  // Every page overlapping the range is mapped, so widen it to whole pages
+  const std::uintptr_t first_page{reinterpret_cast<std::uintptr_t>(begin) & ~(page_size() - 1)};
+  const std::uintptr_t last_page{(reinterpret_cast<std::uintptr_t>(end) + page_size() - 1) & ~(page_size() - 1)};
+
+  if (::madvise(reinterpret_cast<void*>(first_page), last_page - first_page, MADV_POPULATE_WRITE) == 0) {
+    return;
+  }
+#endif
+
+#if defined(_MSC_VER)
+  const std::size_t step{4096};
+#else
+  const std::size_t step{page_size()};
+#endif
+
+  for (volatile char* page = begin; page < end; page += step) {
+    // Write the value back so the page is populated without changing it
+    *page = *page;
+  }
+}
+
+} // end anonymous namespace
+
+std::size_t get_available_host_memory() noexcept
+{
+  try {
+    return std::min(meminfo_available(), cgroup_headroom());
+  } catch (...) {
+    return s_unknown;
+  }
+}
+
+std::size_t host_page_size() noexcept
+{
+#if defined(_MSC_VER)
+  return 0;
+#else
+  return static_cast<std::size_t>(page_size());
+#endif
+}
+
+std::size_t decommit_host_memory(void* ptr, std::size_t bytes, bool lazy) noexcept
+{
+#if defined(_MSC_VER)
+  UMPIRE_USE_VAR(ptr);
+  UMPIRE_USE_VAR(bytes);
+  UMPIRE_USE_VAR(lazy);
+  return 0;
+#else
+  const std::uintptr_t start{reinterpret_cast<std::uintptr_t>(ptr)};
+  const std::uintptr_t first_page{(start + page_size() - 1) & ~(page_size() - 1)};
+  const std::uintptr_t last_page{(start + bytes) & ~(page_size() - 1)};
+
+  if (bytes == 0 || last_page <= first_page) {
+    return 0;
+  }
+
+  const std::size_t length{static_cast<std::size_t>(last_page - first_page)};
+  int advice{MADV_DONTNEED};
+
+#if defined(MADV_FREE)
+  if (lazy) {
+    advice = MADV_FREE;
+  }
+#else
+  UMPIRE_USE_VAR(lazy);
+#endif
+
+  if (::madvise(reinterpret_cast<void*>(first_page), length, advice) != 0) {
+    UMPIRE_LOG(Debug, "madvise(" << reinterpret_cast<void*>(first_page) << ", " << length << ") failed");
+    return 0;
+  }
+
+  return length;
+#endif
+}
+
+std::size_t prefault_host_memory(void* ptr, std::size_t bytes, unsigned int nthreads) noexcept
+{
+  if (ptr == nullptr || bytes == 0) {
+    return 0;
+  }
+
+  if (nthreads == 0) {
+    nthreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  const std::size_t max_threads{std::max(bytes / s_min_prefault_bytes_per_thread, std::size_t{1})};
+  if (nthreads > max_threads) {
+    nthreads = static_cast<unsigned int>(max_threads);
+  }
+
+  char* begin{static_cast<char*>(ptr)};
+  char* end{begin + bytes};
+
+#if !defined(_MSC_VER)
+  // Keep slices page-aligned so that no page is populated twice
+  const std::size_t slice{((bytes / nthreads) + page_size() - 1) & ~(page_size() - 1)};
+#else
+  const std::size_t slice{bytes / nthreads};
+#endif
+
+  std::vector<std::thread> threads;
+  char* slice_begin{begin};
+
+  try {
+    for (unsigned int i{1}; i < nthreads && slice_begin + slice < end; i++) {
+      threads.emplace_back(prefault_range, slice_begin, slice_begin + slice);
+      slice_begin += slice;
+    }
+  } catch (...) {
+    UMPIRE_LOG(Debug, "Could not start prefault thread, prefaulting remaining range serially");
+  }
+
+  prefault_range(slice_begin, end);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  UMPIRE_LOG(Debug, "Prefaulted " << bytes << " bytes @ " << ptr << " with " << (threads.size() + 1) << " threads");
+  return bytes;
+}
+
+} // end namespace util
+} // end namespace umpire
@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_system_memory_HPP
+#define UMPIRE_system_memory_HPP
+
+#include <cstddef>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Get the number of bytes of host memory still available to this
+ * process.
+ *
+ * This is the smaller of MemAvailable from /proc/meminfo and the headroom
+ * left under the memory limit of the cgroup (v1 or v2) that the process
+ * belongs to.
+ *
+ * \return Available bytes, or the largest std::size_t if the value cannot
+ * be determined on this system.
+ */
+std::size_t get_available_host_memory() noexcept;
+
+/*!
+ * \brief Return the size of a host memory page, or 0 where decommitting is
+ * not supported.
+ */
+std::size_t host_page_size() noexcept;
+
+/*!
+ * \brief Return the physical pages backing [ptr, ptr + bytes) to the
+ * operating system while keeping the virtual address range mapped.
+ *
+ * Only the pages lying entirely inside the range are decommitted, so the
+ * bytes at either end that share a page with other data are left untouched.
+ * The contents of decommitted pages are lost; touching them again faults in
+ * fresh pages.
+ *
+ * \param lazy Use MADV_FREE where available, letting the kernel reclaim the
+ * pages only under memory pressure, instead of MADV_DONTNEED.
+ *
+ * \return Number of bytes decommitted, 0 if the range holds no whole page or
+ * decommitting is not supported on this system.
+ */
+std::size_t decommit_host_memory(void* ptr, std::size_t bytes, bool lazy = false) noexcept;
+
+/*!
+ * \brief Fault in the physical pages backing [ptr, ptr + bytes) so that the
+ * first touch by the application does not pay for them.
+ *
+ * The range is split across nthreads threads, each of which populates its
+ * part with MADV_POPULATE_WRITE where available, or by touching every page.
+ * Pages are placed according to the memory policy of the range, so memory
+ * bound to a NUMA node is faulted in on that node.
+ *
+ * \param nthreads Number of threads to use, 0 to use one per hardware thread.
+ *
+ * \return Number of bytes faulted in.
+ */
+std::size_t prefault_host_memory(void* ptr, std::size_t bytes, unsigned int nthreads = 0) noexcept;
+
+} // end namespace util
+} // end namespace umpire
+
+#endif // UMPIRE_system_memory_HPP
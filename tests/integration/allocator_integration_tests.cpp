@@ -149,6 +149,41 @@ TEST_P(AllocatorTest, getActualSize)
   m_allocator->deallocate(data);
 }
 
+TEST_P(AllocatorTest, AllocateDeallocateBulk)
+{
+  const std::size_t count{16};
+  void* ptrs[count + 1];
+
+  m_allocator->allocate_bulk(count, 128, ptrs);
+  ptrs[count] = nullptr;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    ASSERT_NE(nullptr, ptrs[i]);
+    ASSERT_EQ(m_allocator->getSize(ptrs[i]), 128);
+  }
+  ASSERT_EQ(m_allocator->getCurrentSize(), count * 128);
+
+  ASSERT_NO_THROW(m_allocator->deallocate_bulk(ptrs, count + 1));
+  ASSERT_EQ(m_allocator->getCurrentSize(), 0);
+}
+
+TEST_P(AllocatorTest, AllocateDeallocateSized)
+{
+  void* ptr = m_allocator->allocate(128);
+  ASSERT_EQ(m_allocator->getCurrentSize(), 128);
+
+#if !defined(NDEBUG)
+  ASSERT_THROW(m_allocator->deallocate(ptr, 64), umpire::util::Exception);
+  ASSERT_EQ(m_allocator->getCurrentSize(), 128);
+#endif
+
+  ASSERT_NO_THROW(m_allocator->deallocate(ptr, 128));
+  ASSERT_EQ(m_allocator->getCurrentSize(), 0);
+  ASSERT_EQ(m_allocator->getAllocationCount(), 0);
+
+  ASSERT_NO_THROW(m_allocator->deallocate(nullptr, 0));
+}
+
 TEST_P(AllocatorTest, getStrategyName)
 {
   ASSERT_EQ(m_allocator->getStrategyName(), "MemoryResource");
@@ -287,6 +322,25 @@ TEST(Allocation, DeallocateDifferent)
   ASSERT_NO_THROW(alloc_one.deallocate(data));
 }
 
+TEST(Allocation, DeallocateBulkDifferent)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto alloc_one = rm.getAllocator("HOST");
+  auto alloc_two = rm.makeAllocator<umpire::strategy::SizeLimiter>("BulkLimiter", alloc_one, 1024);
+
+  void* ptrs[2];
+  ptrs[0] = alloc_two.allocate(64);
+  ptrs[1] = alloc_one.allocate(64);
+
+  // Nothing is freed when one of the pointers belongs to another allocator
+  ASSERT_THROW(alloc_two.deallocate_bulk(ptrs, 2), umpire::util::Exception);
+  ASSERT_EQ(alloc_two.getCurrentSize(), 64);
+
+  ASSERT_NO_THROW(alloc_two.deallocate(ptrs[0]));
+  ASSERT_NO_THROW(alloc_one.deallocate(ptrs[1]));
+}
+
 #if defined(UMPIRE_ENABLE_CUDA) || defined(UMPIRE_ENABLE_HIP) || defined(UMPIRE_ENABLE_SYCL)
 TEST(Allocator, DeallocateDifferentUMDevice)
 {
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/AllocatorResource.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+TEST(AllocatorResource, AllocateDeallocate)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto allocator = rm.getAllocator("HOST");
+  umpire::pmr::AllocatorResource resource{allocator};
+
+  const std::size_t before{allocator.getCurrentSize()};
+
+  void* ptr{resource.allocate(1024)};
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(allocator.getCurrentSize(), before + 1024);
+
+  resource.deallocate(ptr, 1024);
+  ASSERT_EQ(allocator.getCurrentSize(), before);
+}
+
+TEST(AllocatorResource, OverAligned)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  umpire::pmr::AllocatorResource resource{rm.getAllocator("HOST")};
+
+  for (std::size_t alignment : {64, 4096}) {
+    void* ptr{resource.allocate(100, alignment)};
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+    resource.deallocate(ptr, 100, alignment);
+  }
+}
+
+TEST(AllocatorResource, IsEqual)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  umpire::pmr::AllocatorResource host{rm.getAllocator("HOST")};
+  umpire::pmr::AllocatorResource other_host{rm.getAllocator("HOST")};
+
+  ASSERT_TRUE(host == other_host);
+  ASSERT_FALSE(host == *std::pmr::new_delete_resource());
+}
+
+TEST(AllocatorResource, Containers)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  umpire::pmr::AllocatorResource resource{rm.getAllocator("HOST")};
+
+  std::pmr::vector<double> vector{&resource};
+  vector.resize(1000, 1.0);
+  ASSERT_EQ(vector.get_allocator().resource(), &resource);
+  ASSERT_EQ(vector[999], 1.0);
+}
+
+TEST(AllocatorResource, PoolResources)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto pool = rm.makeAllocator<umpire::strategy::QuickPool>("allocator_resource_pool", rm.getAllocator("HOST"));
+
+  const int num_nodes{10000};
+
+  {
+    umpire::pmr::UnsynchronizedPoolResource resource{pool};
+    ASSERT_EQ(resource.getAllocator().getId(), pool.getId());
+
+    std::pmr::map<int, int> map{&resource};
+    for (int i = 0; i < num_nodes; ++i) {
+      map[i] = i;
+    }
+
+    // Nodes come from slabs, not from one pool allocation each
+    ASSERT_GT(pool.getCurrentSize(), 0);
+    ASSERT_LT(pool.getAllocationCount(), static_cast<std::size_t>(num_nodes / 10));
+  }
+  ASSERT_EQ(pool.getCurrentSize(), 0);
+
+  {
+    umpire::pmr::SynchronizedPoolResource resource{pool};
+
+    std::pmr::unordered_map<int, std::pmr::string> map{&resource};
+    for (int i = 0; i < num_nodes; ++i) {
+      map.emplace(i, std::to_string(i));
+    }
+
+    ASSERT_EQ(map.at(num_nodes - 1), std::to_string(num_nodes - 1).c_str());
+  }
+  ASSERT_EQ(pool.getCurrentSize(), 0);
+
+  {
+    umpire::pmr::MonotonicBufferResource resource{pool, 4096};
+
+    std::pmr::vector<int> vector{&resource};
+    for (int i = 0; i < num_nodes; ++i) {
+      vector.push_back(i);
+    }
+
+    resource.release();
+    ASSERT_EQ(pool.getCurrentSize(), 0);
+  }
+}
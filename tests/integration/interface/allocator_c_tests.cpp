@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+
 #include "gtest/gtest.h"
 #include "umpire/config.hpp"
 #include "umpire/interface/c_fortran/umpire.h"
@@ -144,6 +146,63 @@ TEST_P(AllocatorCTest, HasAllocator)
   ASSERT_EQ(false, umpire_resourcemanager_has_allocator(&rm, (void*)data));
 }
 
+TEST_P(AllocatorCTest, Handle)
+{
+  umpire_handle handle = umpire_handle_get_by_name(GetParam());
+  int id = umpire_allocator_get_id(&m_allocator);
+
+  ASSERT_EQ(id, umpire_handle_get_id(handle));
+  ASSERT_EQ(handle, umpire_handle_get_by_id(id));
+  ASSERT_EQ(handle, umpire_handle_get_from_allocator(&m_allocator));
+  ASSERT_EQ(handle, umpire_handle_get_by_name_bufferify(GetParam(), static_cast<int>(std::strlen(GetParam()))));
+
+  double* data = (double*)umpire_handle_allocate(handle, m_big * sizeof(double));
+  ASSERT_NE(nullptr, data);
+  ASSERT_EQ(m_big * sizeof(double), umpire_allocator_get_current_size(&m_allocator));
+
+  umpire_handle_deallocate(handle, data);
+  ASSERT_EQ(0, umpire_allocator_get_current_size(&m_allocator));
+
+  data = (double*)umpire_handle_allocate(handle, m_small * sizeof(double));
+  umpire_handle_deallocate_sized(handle, data, m_small * sizeof(double));
+  ASSERT_EQ(0, umpire_allocator_get_current_size(&m_allocator));
+}
+
+TEST_P(AllocatorCTest, HandleBulk)
+{
+  umpire_handle handle = umpire_handle_get_by_name(GetParam());
+  void* ptrs[16];
+
+  umpire_handle_allocate_bulk(handle, 16, m_big, ptrs);
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_NE(nullptr, ptrs[i]);
+  }
+  ASSERT_EQ(16 * m_big, umpire_allocator_get_current_size(&m_allocator));
+
+  umpire_handle_deallocate_bulk(handle, ptrs, 16);
+  ASSERT_EQ(0, umpire_allocator_get_current_size(&m_allocator));
+}
+
+TEST(AllocatorCHandle, CopyMemset)
+{
+  umpire_handle handle = umpire_handle_get_by_name("HOST");
+  const std::size_t bytes = 64;
+
+  char* src = (char*)umpire_handle_allocate(handle, bytes);
+  char* dst = (char*)umpire_handle_allocate(handle, bytes);
+
+  umpire_memset(src, 7, bytes);
+  umpire_memset(dst, 0, 0);
+  umpire_copy(dst, src, bytes);
+
+  for (std::size_t i = 0; i < bytes; ++i) {
+    ASSERT_EQ(7, dst[i]);
+  }
+
+  umpire_handle_deallocate(handle, dst);
+  umpire_handle_deallocate(handle, src);
+}
+
 const char* allocator_names[] = {"HOST"
 #if defined(UMPIRE_ENABLE_DEVICE)
                                  ,
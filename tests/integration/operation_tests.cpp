@@ -828,3 +828,32 @@ TEST(AsyncTest, Prefetch)
   alloc.deallocate(array);
 }
 #endif
+
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+TEST(AsyncTest, FilePrefetch)
+{
+  auto resource = camp::resources::Resource{camp::resources::Host{}};
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  constexpr std::size_t size = 1024 * 1024;
+
+  auto alloc = rm.getAllocator("FILE");
+  float* array = static_cast<float*>(alloc.allocate(size * sizeof(float)));
+
+  ASSERT_NE(array, nullptr);
+
+  // Prefetch the whole allocation and from an unaligned pointer inside it
+  camp::resources::Event event = rm.prefetch(array, 0, resource);
+  event.wait();
+
+  event = rm.prefetch(array + 1001, 0, resource);
+  event.wait();
+
+  alloc.deallocate(array);
+
+  auto host_alloc = rm.getAllocator("HOST");
+  void* host_array = host_alloc.allocate(size);
+  ASSERT_THROW(rm.prefetch(host_array, 0, resource), umpire::util::Exception);
+  host_alloc.deallocate(host_array);
+}
+#endif
@@ -326,6 +326,63 @@ TYPED_TEST(PrimaryPoolTest, largestavailable)
   }
 }
 
+TYPED_TEST(PrimaryPoolTest, FreeStatistics)
+{
+  using Pool = typename TestFixture::Pool;
+  using umpire::util::FreeBlockStatistics;
+  const int num_allocs = 4;
+
+  auto pool = umpire::util::unwrap_allocator<Pool>(*this->m_allocator);
+
+  ASSERT_NE(pool, nullptr);
+
+  ASSERT_NO_THROW({
+    void* ptr{this->m_allocator->allocate(1024)};
+    this->m_allocator->deallocate(ptr);
+  });
+
+  FreeBlockStatistics stats{pool->getFreeStatistics()};
+  ASSERT_EQ(stats.free_blocks, 1);
+  ASSERT_EQ(stats.total_free, this->m_initial_pool_size);
+  ASSERT_EQ(stats.largest_free, this->m_initial_pool_size);
+  ASSERT_EQ(stats.histogram[FreeBlockStatistics::bin(this->m_initial_pool_size)], 1);
+  ASSERT_FLOAT_EQ(umpire::util::relative_fragmentation(stats), 0.0f);
+
+  void* ptrs[num_allocs];
+
+  for (int i{0}; i < num_allocs; ++i) {
+    ASSERT_NO_THROW(ptrs[i] = this->m_allocator->allocate(1024););
+  }
+
+  const std::size_t tail_size{this->m_initial_pool_size - num_allocs * 1024};
+
+  // Free a chunk between two used ones
+  ASSERT_NO_THROW(this->m_allocator->deallocate(ptrs[1]););
+  stats = pool->getFreeStatistics();
+  ASSERT_EQ(stats.free_blocks, 2);
+  ASSERT_EQ(stats.total_free, tail_size + 1024);
+  ASSERT_EQ(stats.largest_free, tail_size);
+  ASSERT_EQ(stats.histogram[FreeBlockStatistics::bin(1024)], 1);
+  ASSERT_GT(umpire::util::relative_fragmentation(stats), 0.0f);
+
+  // Merge with the previous chunk
+  ASSERT_NO_THROW(this->m_allocator->deallocate(ptrs[0]););
+  stats = pool->getFreeStatistics();
+  ASSERT_EQ(stats.free_blocks, 2);
+  ASSERT_EQ(stats.total_free, tail_size + 2048);
+  ASSERT_EQ(stats.histogram[FreeBlockStatistics::bin(1024)], 0);
+  ASSERT_EQ(stats.histogram[FreeBlockStatistics::bin(2048)], 1);
+
+  // Merge with the tail of the block
+  ASSERT_NO_THROW(this->m_allocator->deallocate(ptrs[3]););
+  stats = pool->getFreeStatistics();
+  ASSERT_EQ(stats.free_blocks, 2);
+  ASSERT_EQ(stats.total_free, tail_size + 3072);
+  ASSERT_EQ(stats.largest_free, tail_size + 1024);
+
+  ASSERT_NO_THROW(this->m_allocator->deallocate(ptrs[2]););
+}
+
 TYPED_TEST(PrimaryPoolTest, coalesce)
 {
   using Pool = typename TestFixture::Pool;
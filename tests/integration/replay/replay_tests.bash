@@ -20,6 +20,7 @@ function cleanupandexit {
     rm -f $f
   done
   cd $mydir
+  rm -f analysis.out simulation.out
   exit $1
 }
 
@@ -56,4 +57,56 @@ if [ $? -ne 0 ]; then
     cleanupandexit 1
 fi
 
+#
+# The analysis of the log covers the HOST resource and recommends pool
+# parameters for it, and every allocator frees all it allocated
+#
+echo "$replayprogram -q -i replay.replay --analyze"
+$replayprogram -q -i replay.replay --analyze > analysis.out
+if [ $? -ne 0 ]; then
+    echo "$replayprogram --analyze Failed"
+    cleanupandexit 1
+fi
+
+for pattern in "^Analysis of replay.replay" "^HOST (MemoryResource):" "Peak Live Bytes:" \
+               "Recommended QuickPool/DynamicPoolList Parameters:" "first_minimum_pool_allocation_size = "; do
+  if ! grep -q "$pattern" analysis.out; then
+    echo "Analysis report is missing '$pattern'"
+    cleanupandexit 1
+  fi
+done
+
+if ! awk '/Total Allocations:/ { a = $3 } /Total Deallocations:/ { if ($3 != a) bad = 1; n++ }
+          END { exit (bad || n == 0) }' analysis.out; then
+    echo "Analysis report has unbalanced allocations"
+    cleanupandexit 1
+fi
+
+#
+# Simulating the log over NO_OP resources with overridden block sizes grows
+# every QuickPool by exactly one first block, and reports the resource
+#
+echo "$replayprogram -q -i replay.replay --simulate --first-block-size 65536 --next-block-size 4096"
+$replayprogram -q -i replay.replay --simulate --first-block-size 65536 --next-block-size 4096 > simulation.out
+if [ $? -ne 0 ]; then
+    echo "$replayprogram --simulate Failed"
+    cleanupandexit 1
+fi
+
+if ! grep -q "^Allocator .*Peak Actual" simulation.out || ! grep -q "^Resource .*Peak Bytes" simulation.out; then
+    echo "Simulation report is missing its tables"
+    cleanupandexit 1
+fi
+
+if ! awk '/^HOST_Pool_spec_/ { n++; if ($7 != 65536) bad = 1 } END { exit (bad || n == 0) }' simulation.out; then
+    echo "Simulated QuickPools did not use the overridden block sizes"
+    cleanupandexit 1
+fi
+
+if ! awk '/^Resource / { table = 1; next } table && /^HOST / { found = 1; if ($2 == 0 || $3 == 0) bad = 1 }
+          END { exit (bad || !found) }' simulation.out; then
+    echo "Simulation report has no usage for the HOST resource"
+    cleanupandexit 1
+fi
+
 cleanupandexit 0
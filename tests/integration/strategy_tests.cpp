@@ -4,6 +4,10 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstdio>
+#include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -12,22 +16,33 @@
 #include "umpire/config.hpp"
 #include "umpire/strategy/AlignedAllocator.hpp"
 #include "umpire/strategy/AllocationAdvisor.hpp"
+#include "umpire/strategy/AllocationMetrics.hpp"
+#include "umpire/strategy/AllocationProfiler.hpp"
 #include "umpire/strategy/AllocationStrategy.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/FixedPool.hpp"
+#include "umpire/strategy/HierarchicalPool.hpp"
+#include "umpire/strategy/MagazinePool.hpp"
 #include "umpire/strategy/MixedPool.hpp"
 #include "umpire/strategy/MonotonicAllocationStrategy.hpp"
 #include "umpire/strategy/NamedAllocationStrategy.hpp"
 #include "umpire/strategy/QuickPool.hpp"
 #include "umpire/strategy/SizeLimiter.hpp"
 #include "umpire/strategy/SlotPool.hpp"
+#include "umpire/strategy/ThreadHeapPool.hpp"
 #include "umpire/strategy/ThreadSafeAllocator.hpp"
+#include "umpire/util/pool_size_store.hpp"
+#include "umpire/util/wrap_allocator.hpp"
 
 #if defined(UMPIRE_ENABLE_NUMA)
 #include "umpire/strategy/NumaPolicy.hpp"
 #include "umpire/util/numa.hpp"
 #endif
 
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+#include "umpire/strategy/OutOfCoreAllocator.hpp"
+#endif
+
 #include "umpire/Umpire.hpp"
 
 #if defined(_OPENMP)
@@ -150,10 +165,12 @@ using Strategies =
 #if defined(UMPIRE_ENABLE_CUDA)
                      umpire::strategy::AllocationAdvisor,
 #endif
-                     umpire::strategy::DynamicPoolList, umpire::strategy::FixedPool, umpire::strategy::MixedPool,
+                     umpire::strategy::AllocationMetrics, umpire::strategy::AllocationProfiler,
+                     umpire::strategy::DynamicPoolList, umpire::strategy::FixedPool,
+                     umpire::strategy::HierarchicalPool, umpire::strategy::MagazinePool, umpire::strategy::MixedPool,
                      umpire::strategy::MonotonicAllocationStrategy, umpire::strategy::NamedAllocationStrategy,
                      umpire::strategy::QuickPool, umpire::strategy::SizeLimiter, umpire::strategy::SlotPool,
-                     umpire::strategy::ThreadSafeAllocator>;
+                     umpire::strategy::ThreadHeapPool, umpire::strategy::ThreadSafeAllocator>;
 
 TYPED_TEST_SUITE(StrategyTest, Strategies, );
 
@@ -489,6 +506,622 @@ TEST(MixedPool, Host)
     allocator.deallocate(alloc[i]);
 }
 
+TEST(QuickPool, Prewarm)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t first_block{64 * 1024 * 1024};
+  const std::size_t next_block{1024 * 1024};
+  const std::size_t alignment{16};
+
+  auto lazy = rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_lazy", rm.getAllocator("HOST"),
+                                                            first_block);
+  ASSERT_EQ(lazy.getActualSize(), 0);
+
+  for (auto prewarm : {umpire::strategy::QuickPool::Prewarm::allocate, umpire::strategy::QuickPool::Prewarm::prefault}) {
+    std::stringstream name;
+    name << "host_quick_pool_" << prewarm;
+
+    auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>(
+        name.str(), rm.getAllocator("HOST"), first_block, next_block, alignment,
+        umpire::strategy::QuickPool::percent_releasable(100), prewarm);
+    auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+
+    ASSERT_EQ(allocator.getActualSize(), first_block);
+    ASSERT_EQ(allocator.getCurrentSize(), 0);
+    ASSERT_EQ(pool->getReleasableBlocks(), 1);
+
+    void* alloc = allocator.allocate(first_block);
+    ASSERT_EQ(allocator.getActualSize(), first_block);
+    allocator.deallocate(alloc);
+  }
+}
+
+TEST(QuickPool, Bulk)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block{1024 * 1024};
+  const std::size_t count{64};
+
+  auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_bulk", rm.getAllocator("HOST"),
+                                                                 block, block);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+
+  std::vector<void*> ptrs(count);
+  allocator.allocate_bulk(count, 100, ptrs.data());
+
+  // The blocks are carved contiguously out of the pool's first block
+  for (std::size_t i = 1; i < count; ++i) {
+    ASSERT_EQ(static_cast<char*>(ptrs[i]) - static_cast<char*>(ptrs[i - 1]), 112);
+  }
+  ASSERT_EQ(allocator.getCurrentSize(), count * 112);
+  ASSERT_EQ(pool->getBlocksInPool(), count + 1);
+
+  // Blocks may also be freed one at a time
+  allocator.deallocate(ptrs[0]);
+  allocator.deallocate_bulk(ptrs.data() + 1, count - 1);
+
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_EQ(pool->getBlocksInPool(), 1);
+
+  // A total size that does not fit in a size_t is refused before allocating
+  const std::size_t max{std::numeric_limits<std::size_t>::max()};
+  ASSERT_THROW(allocator.allocate_bulk(max / 64, 100, ptrs.data()), umpire::util::Exception);
+  ASSERT_THROW(allocator.allocate_bulk(2, max - 8, ptrs.data()), umpire::util::Exception);
+  ASSERT_EQ(allocator.getActualSize(), block);
+  ASSERT_EQ(pool->getBlocksInPool(), 1);
+}
+
+TEST(QuickPool, Decommit)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block{1024 * 1024};
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_decommit", rm.getAllocator("HOST"), block, block);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+
+  void* data = allocator.allocate(block / 2);
+  const std::size_t decommitted{pool->decommit()};
+  ASSERT_GT(decommitted, 0);
+
+  // Chunks already decommitted are left alone
+  ASSERT_EQ(pool->decommit(), 0);
+
+  // until they are used again
+  void* small = allocator.allocate(64);
+  allocator.deallocate(small);
+  allocator.deallocate(data);
+  ASSERT_GE(pool->decommit(), decommitted);
+  ASSERT_EQ(pool->decommit(), 0);
+
+  // and chunks smaller than a page are never worth it
+  void* filler = allocator.allocate(block - 64);
+  ASSERT_EQ(pool->decommit(), 0);
+  allocator.deallocate(filler);
+}
+
+TEST(QuickPool, OwnedRecords)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_records", rm.getAllocator("HOST"));
+  auto other = rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_records_other", rm.getAllocator("HOST"));
+
+  void* data = allocator.allocate(100);
+  void* offset = static_cast<char*>(data) + 50;
+  void* end = static_cast<char*>(data) + 100;
+  void* named = allocator.allocate("named", 50);
+
+  // The records are kept by the pool, and found through its address range
+  ASSERT_TRUE(rm.hasAllocator(data));
+  ASSERT_EQ(rm.getAllocator(data).getId(), allocator.getId());
+  ASSERT_EQ(rm.getAllocator(offset).getId(), allocator.getId());
+  ASSERT_EQ(rm.getSize(data), 100);
+  ASSERT_EQ(rm.findAllocationRecord(named)->name, "named");
+  ASSERT_FALSE(rm.hasAllocator(end));
+
+  ASSERT_NO_THROW(rm.memset(data, 0));
+  ASSERT_NO_THROW(rm.copy(named, data, 50));
+
+  ASSERT_EQ(umpire::get_allocator_records(allocator).size(), 2);
+
+  ASSERT_THROW(other.deallocate(data), umpire::util::Exception);
+  ASSERT_TRUE(rm.hasAllocator(data));
+
+  allocator.deallocate(data);
+  allocator.deallocate(named, 50);
+
+  ASSERT_FALSE(rm.hasAllocator(data));
+  ASSERT_THROW(rm.getAllocator(named), umpire::util::Exception);
+  ASSERT_EQ(allocator.getAllocationCount(), 0);
+  ASSERT_EQ(umpire::get_allocator_records(allocator).size(), 0);
+}
+
+TEST(QuickPool, OwnedRecordsFromOtherThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_records_thread", rm.getAllocator("HOST"), 1024);
+
+  void* data = allocator.allocate(100);
+  void* offset = static_cast<char*>(data) + 50;
+  std::atomic<bool> done{false};
+
+  // Query the record while the pool splits and merges chunks on this thread
+  std::thread reader{[&] {
+    while (!done) {
+      EXPECT_EQ(rm.getSize(data), 100);
+      EXPECT_EQ(rm.getAllocator(offset).getId(), allocator.getId());
+    }
+  }};
+
+  for (int i = 0; i < 1000; ++i) {
+    void* ptr = allocator.allocate(64 + i % 512);
+    allocator.deallocate(ptr);
+  }
+
+  done = true;
+  reader.join();
+
+  allocator.deallocate(data);
+}
+
+TEST(QuickPool, OwnedRecordsPoolOverPool)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  // Whichever pool takes a record first indexes the blocks they share
+  for (int parent_first = 0; parent_first < 2; ++parent_first) {
+    const std::string suffix{std::to_string(parent_first)};
+    auto parent = rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_parent_" + suffix,
+                                                                rm.getAllocator("HOST"), 64 * 1024, 1024);
+    auto child =
+        rm.makeAllocator<umpire::strategy::QuickPool>("host_quick_pool_child_" + suffix, parent, 4096, 1024);
+
+    void* parent_data{nullptr};
+    void* child_data{nullptr};
+    if (parent_first) {
+      parent_data = parent.allocate(100);
+      child_data = child.allocate(200);
+    } else {
+      child_data = child.allocate(200);
+      parent_data = parent.allocate(100);
+    }
+    void* child_offset = static_cast<char*>(child_data) + 100;
+    void* parent_offset = static_cast<char*>(parent_data) + 50;
+
+    ASSERT_EQ(rm.getAllocator(parent_data).getId(), parent.getId());
+    ASSERT_EQ(rm.getAllocator(parent_offset).getId(), parent.getId());
+    ASSERT_EQ(rm.getSize(parent_data), 100);
+    ASSERT_EQ(rm.getAllocator(child_data).getId(), child.getId());
+    ASSERT_EQ(rm.getAllocator(child_offset).getId(), child.getId());
+    ASSERT_EQ(rm.getSize(child_data), 200);
+
+    // Later blocks and records of both pools are found too
+    void* child_large = child.allocate(8192);
+    void* parent_large = parent.allocate(128 * 1024);
+    ASSERT_EQ(rm.getAllocator(child_large).getId(), child.getId());
+    ASSERT_EQ(rm.getAllocator(parent_large).getId(), parent.getId());
+
+    child.deallocate(child_large);
+    parent.deallocate(parent_large);
+    child.deallocate(child_data);
+    parent.deallocate(parent_data);
+
+    ASSERT_FALSE(rm.hasAllocator(child_data));
+    ASSERT_FALSE(rm.hasAllocator(parent_data));
+    ASSERT_EQ(child.getCurrentSize(), 0);
+
+    // The parent holds the child's blocks until they are released
+    child.release();
+    ASSERT_EQ(parent.getCurrentSize(), 0);
+    parent.release();
+    ASSERT_EQ(parent.getActualSize(), 0);
+  }
+}
+
+TEST(QuickPool, GeometricGrowth)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block{1024 * 1024};
+  const int num_allocs{64};
+
+  auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>(
+      "host_quick_pool_geometric", rm.getAllocator("HOST"), block, block, 16,
+      umpire::strategy::QuickPool::percent_releasable(100), umpire::strategy::QuickPool::Prewarm::none,
+      umpire::strategy::QuickPool::geometric_growth(2.0));
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+
+  std::vector<void*> allocs;
+  for (int i = 0; i < num_allocs; ++i) {
+    allocs.push_back(allocator.allocate(block));
+  }
+
+  // Doubling the pool reaches 64 blocks worth in 7 blocks
+  ASSERT_GE(allocator.getActualSize(), num_allocs * block);
+  ASSERT_LE(allocator.getActualSize(), 2 * num_allocs * block);
+  ASSERT_LE(pool->getTotalBlocks(), 7);
+
+  for (auto alloc : allocs) {
+    allocator.deallocate(alloc);
+  }
+
+  ASSERT_ANY_THROW(umpire::strategy::QuickPool::geometric_growth(1.0));
+}
+
+TEST(QuickPool, PersistentGrowth)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::string filename{"umpire_quick_pool_sizes.txt"};
+  const std::string name{"host_quick_pool_persistent"};
+  const std::size_t block{1024 * 1024};
+  const std::size_t stored_size{16 * block};
+
+  umpire::util::write_pool_size(filename, "another pool", block);
+  umpire::util::write_pool_size(filename, name, stored_size);
+
+  auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>(
+      name, rm.getAllocator("HOST"), block, block, 16, umpire::strategy::QuickPool::percent_releasable(100),
+      umpire::strategy::QuickPool::Prewarm::none, umpire::strategy::QuickPool::persistent_growth(filename));
+
+  // The first block is sized to the stored peak
+  void* alloc = allocator.allocate(block);
+  ASSERT_EQ(allocator.getActualSize(), stored_size);
+
+  void* large = allocator.allocate(stored_size);
+  ASSERT_GT(allocator.getActualSize(), stored_size);
+  ASSERT_EQ(umpire::util::read_pool_size(filename, name), allocator.getActualSize());
+  ASSERT_EQ(umpire::util::read_pool_size(filename, "another pool"), block);
+
+  allocator.deallocate(large);
+  allocator.deallocate(alloc);
+
+  std::remove(filename.c_str());
+}
+
+TEST(HierarchicalPool, ProducerConsumer)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::HierarchicalPool>("host_hierarchical_pool_producer_consumer",
+                                                                        rm.getAllocator("HOST"));
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::HierarchicalPool>(allocator);
+
+  constexpr int N = 1024;
+  constexpr int rounds = 16;
+  std::size_t actual_size{0};
+
+  for (int round = 0; round < rounds; ++round) {
+    std::vector<void*> allocs(N);
+
+    //
+    // Allocate on one thread and free on another, so every free is remote
+    //
+    std::thread producer{[&] {
+      for (int i = 0; i < N; ++i) {
+        allocs[i] = allocator.allocate(64 + (i % 8) * 512);
+        ASSERT_NE(allocs[i], nullptr);
+      }
+    }};
+    producer.join();
+
+    std::thread consumer{[&] {
+      for (auto alloc : allocs) {
+        allocator.deallocate(alloc);
+      }
+    }};
+    consumer.join();
+
+    if (round == 0) {
+      actual_size = allocator.getActualSize();
+    }
+  }
+
+  //
+  // Blocks freed remotely by exited threads are reused rather than leaked,
+  // and so is the cache of each exited producer
+  //
+  ASSERT_EQ(allocator.getActualSize(), actual_size);
+  ASSERT_EQ(pool->getNumThreadCaches(), 1);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
+TEST(HierarchicalPool, HostStdThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::HierarchicalPool>("host_hierarchical_pool_std",
+                                                                        rm.getAllocator("HOST"), 1024, 4096);
+
+  constexpr int N = 16;
+  constexpr int M = 256;
+  std::vector<std::vector<void*>> thread_allocs(N, std::vector<void*>(M));
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < N; i++) {
+    threads.push_back(std::thread([=, &allocator, &thread_allocs] {
+      for (int j = 0; j < M; ++j) {
+        thread_allocs[i][j] = allocator.allocate((j % 4 == 0) ? 4096 : 128);
+        ASSERT_NE(thread_allocs[i][j], nullptr);
+      }
+
+      for (int j = 0; j < M; ++j) {
+        void* alloc = allocator.allocate(128);
+        allocator.deallocate(alloc);
+      }
+    }));
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  //
+  // Free the allocations of a neighbouring thread after it has exited
+  //
+  for (int i = 0; i < N; i++) {
+    threads[i] = std::thread([=, &allocator, &thread_allocs] {
+      for (auto alloc : thread_allocs[(i + 1) % N]) {
+        allocator.deallocate(alloc);
+      }
+    });
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // Threads that start after another has exited take over its cache
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::HierarchicalPool>(allocator);
+  ASSERT_GE(pool->getNumThreadCaches(), 1);
+  ASSERT_LE(pool->getNumThreadCaches(), N);
+}
+
+TEST(ThreadHeapPool, ProducerConsumer)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadHeapPool>("host_thread_heap_pool_producer_consumer",
+                                                                      rm.getAllocator("HOST"));
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::ThreadHeapPool>(allocator);
+
+  constexpr int N = 1024;
+  constexpr int rounds = 16;
+  std::size_t actual_size{0};
+
+  for (int round = 0; round < rounds; ++round) {
+    std::vector<void*> allocs(N);
+
+    //
+    // Allocate on one thread and free on another, so every free is remote
+    //
+    std::thread producer{[&] {
+      for (int i = 0; i < N; ++i) {
+        allocs[i] = allocator.allocate(64 + (i % 8) * 512);
+        ASSERT_NE(allocs[i], nullptr);
+      }
+    }};
+    producer.join();
+
+    std::thread consumer{[&] {
+      for (auto alloc : allocs) {
+        allocator.deallocate(alloc);
+      }
+    }};
+    consumer.join();
+
+    if (round == 0) {
+      actual_size = allocator.getActualSize();
+    }
+  }
+
+  //
+  // The heap of each exited producer is adopted by the next one along with
+  // its remotely freed blocks, so neither the heaps nor the pool grow
+  //
+  ASSERT_EQ(allocator.getActualSize(), actual_size);
+  ASSERT_EQ(pool->getNumHeaps(), 1);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
+TEST(ThreadHeapPool, LookupFromOtherThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::ThreadHeapPool>("host_thread_heap_pool_lookup", rm.getAllocator("HOST"));
+
+  void* data = allocator.allocate(100);
+  void* offset = static_cast<char*>(data) + 50;
+  std::atomic<bool> done{false};
+
+  // Pointers into a heap are looked up while the heap splits its chunks
+  std::thread reader{[&] {
+    while (!done) {
+      EXPECT_TRUE(rm.hasAllocator(offset));
+      EXPECT_EQ(rm.getSize(data), 100);
+      EXPECT_EQ(rm.getAllocator(offset).getId(), allocator.getId());
+    }
+  }};
+
+  for (int i = 0; i < 1000; ++i) {
+    void* ptr = allocator.allocate(64 + i % 512);
+    allocator.deallocate(ptr);
+  }
+
+  done = true;
+  reader.join();
+
+  allocator.deallocate(data);
+}
+
+TEST(ThreadHeapPool, HostStdThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadHeapPool>("host_thread_heap_pool_std",
+                                                                      rm.getAllocator("HOST"), 64 * 1024, 16 * 1024);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::ThreadHeapPool>(allocator);
+
+  constexpr int N = 16;
+  constexpr int M = 256;
+  std::vector<std::vector<void*>> thread_allocs(N, std::vector<void*>(M));
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < N; i++) {
+    threads.push_back(std::thread([=, &allocator, &thread_allocs] {
+      for (int j = 0; j < M; ++j) {
+        thread_allocs[i][j] = allocator.allocate((j % 4 == 0) ? 4096 : 128);
+        ASSERT_NE(thread_allocs[i][j], nullptr);
+      }
+    }));
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  //
+  // Free the allocations of a neighbouring thread, allocating concurrently so
+  // that remote frees race with the owner draining them
+  //
+  for (int i = 0; i < N; i++) {
+    threads[i] = std::thread([=, &allocator, &thread_allocs] {
+      for (int j = 0; j < M; ++j) {
+        allocator.deallocate(thread_allocs[(i + 1) % N][j]);
+        void* alloc = allocator.allocate(128);
+        allocator.deallocate(alloc);
+      }
+    });
+  }
+
+  //
+  // The size of the pool may be read while its heaps grow
+  //
+  EXPECT_GT(pool->getActualSize(), 0);
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  ASSERT_GE(pool->getActualSize(), N * M * 128);
+
+  //
+  // Threads that start after another has exited reuse its heap
+  //
+  ASSERT_GE(pool->getNumHeaps(), 1);
+  ASSERT_LE(pool->getNumHeaps(), N);
+}
+
+TEST(MagazinePool, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::MagazinePool>("host_magazine_pool", rm.getAllocator("HOST"),
+                                                                    64 * 1024, 16 * 1024);
+
+  void* small = allocator.allocate(20);
+  ASSERT_EQ(rm.getSize(small), 20);
+  allocator.deallocate(small);
+
+  // A freed small allocation is cached for any size of its class
+  ASSERT_EQ(allocator.allocate(30), small);
+  allocator.deallocate(small);
+
+  // Cached allocations are not in use
+  void* large = allocator.allocate(4096);
+  ASSERT_EQ(allocator.getCurrentSize(), 4096);
+  allocator.deallocate(large);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+
+  // but this thread's magazine keeps its block
+  allocator.release();
+  ASSERT_GT(allocator.getActualSize(), 0);
+}
+
+TEST(MagazinePool, Untracked)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::MagazinePool>(
+      "host_magazine_pool_untracked", umpire::Tracking::Untracked, rm.getAllocator("HOST"), 64 * 1024, 16 * 1024);
+
+  // Without a record, an unsized free goes back to the pool
+  void* unsized = allocator.allocate(20);
+  allocator.deallocate(unsized);
+  allocator.release();
+  ASSERT_EQ(allocator.getActualSize(), 0);
+
+  // while a sized one is cached
+  void* sized = allocator.allocate(20);
+  allocator.deallocate(sized, 20);
+  allocator.release();
+  ASSERT_GT(allocator.getActualSize(), 0);
+  ASSERT_EQ(allocator.allocate(20), sized);
+  allocator.deallocate(sized, 20);
+}
+
+TEST(MagazinePool, HostStdThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::MagazinePool>("host_magazine_pool_std", rm.getAllocator("HOST"),
+                                                                    64 * 1024, 16 * 1024);
+
+  constexpr int N = 8;
+  constexpr int M = 256;
+  std::vector<std::vector<char*>> thread_allocs(N, std::vector<char*>(M));
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < N; i++) {
+    threads.push_back(std::thread([=, &allocator, &thread_allocs] {
+      for (int j = 0; j < M; ++j) {
+        const std::size_t size = (j % 8 == 0) ? 4096 : 1 + (j * 37) % 256;
+        thread_allocs[i][j] = static_cast<char*>(allocator.allocate(size));
+        thread_allocs[i][j][0] = thread_allocs[i][j][size - 1] = static_cast<char>(i);
+      }
+    }));
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  //
+  // Free the allocations of a neighbouring thread while allocating, so that
+  // allocations move between the magazines of different threads
+  //
+  for (int i = 0; i < N; i++) {
+    threads[i] = std::thread([=, &allocator, &thread_allocs] {
+      const int other = (i + 1) % N;
+      for (int j = 0; j < M; ++j) {
+        const std::size_t size = (j % 8 == 0) ? 4096 : 1 + (j * 37) % 256;
+        char* alloc = thread_allocs[other][j];
+        EXPECT_EQ(alloc[0], static_cast<char>(other));
+        EXPECT_EQ(alloc[size - 1], static_cast<char>(other));
+        allocator.deallocate(alloc);
+
+        void* reuse = allocator.allocate(size);
+        allocator.deallocate(reuse);
+      }
+    });
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // The magazines of the exited threads are in the depot, so all can go
+  allocator.release();
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_EQ(allocator.getActualSize(), 0);
+}
+
 TEST(ThreadSafeAllocator, HostStdThread)
 {
   auto& rm = umpire::ResourceManager::getInstance();
@@ -527,6 +1160,53 @@ TEST(ThreadSafeAllocator, HostStdThread)
   });
 }
 
+TEST(ThreadSafeAllocator, OverQuickPool)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto pool =
+      rm.makeAllocator<umpire::strategy::QuickPool>("thread_safe_quick_pool_host", rm.getAllocator("HOST"), 1024);
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadSafeAllocator>("thread_safe_over_quick_pool_host", pool);
+
+  constexpr int N = 1000;
+  std::mutex mutex;
+  std::vector<std::pair<void*, std::size_t>> allocations;
+
+  std::thread producer{[&] {
+    for (int i = 0; i < N; ++i) {
+      const std::size_t size = 1 + (i * 37) % 512;
+      void* ptr = allocator.allocate(size);
+      std::lock_guard<std::mutex> lock{mutex};
+      allocations.emplace_back(ptr, size);
+    }
+  }};
+
+  // Look up and free the pointers on another thread than the one that
+  // allocated them, while the pool keeps allocating
+  std::thread consumer{[&] {
+    int freed{0};
+    while (freed < N) {
+      std::vector<std::pair<void*, std::size_t>> taken;
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        taken.swap(allocations);
+      }
+      for (auto& allocation : taken) {
+        EXPECT_EQ(rm.getSize(allocation.first), allocation.second);
+        EXPECT_EQ(rm.getAllocator(allocation.first).getId(), allocator.getId());
+        allocator.deallocate(allocation.first);
+        ++freed;
+      }
+    }
+  }};
+
+  producer.join();
+  consumer.join();
+
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_EQ(pool.getCurrentSize(), 0);
+}
+
 #if defined(_OPENMP)
 TEST(ThreadSafeAllocator, HostOpenMP)
 {
@@ -629,6 +1309,190 @@ TEST(SizeLimiter, Host)
   EXPECT_NO_THROW(alloc.deallocate(data));
 }
 
+TEST(AllocationMetrics, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::AllocationMetrics>("host_metrics", rm.getAllocator("HOST"));
+  auto metrics = umpire::util::unwrap_allocator<umpire::strategy::AllocationMetrics>(allocator);
+
+  ASSERT_EQ(umpire::strategy::AllocationMetrics::bin(1), 0);
+  ASSERT_EQ(umpire::strategy::AllocationMetrics::bin(1024), 10);
+  ASSERT_EQ(umpire::strategy::AllocationMetrics::bin(1025), 11);
+
+  void* ptr{allocator.allocate(1024)};
+
+  std::thread thread{[&]() {
+    void* other{allocator.allocate(100)};
+    allocator.deallocate(other);
+    allocator.deallocate(ptr);
+  }};
+  thread.join();
+
+  auto snapshot = metrics->getMetrics();
+  ASSERT_EQ(snapshot.allocations, 2);
+  ASSERT_EQ(snapshot.deallocations, 2);
+  ASSERT_EQ(snapshot.bytes_allocated, 1124);
+  ASSERT_EQ(snapshot.bytes_deallocated, 1124);
+  ASSERT_EQ(snapshot.size_histogram[7], 1);
+  ASSERT_EQ(snapshot.size_histogram[10], 1);
+
+  std::size_t latency_count{0};
+  for (auto count : snapshot.latency_histogram) {
+    latency_count += count;
+  }
+  ASSERT_EQ(latency_count, 2);
+
+  std::stringstream json;
+  metrics->dump(json, umpire::strategy::AllocationMetrics::Format::json);
+  ASSERT_NE(json.str().find("\"allocations\": 2"), std::string::npos);
+  ASSERT_EQ(json.str().find('\n'), json.str().size() - 1);
+
+  std::stringstream prometheus;
+  metrics->dump(prometheus, umpire::strategy::AllocationMetrics::Format::prometheus);
+  ASSERT_NE(prometheus.str().find("umpire_allocations_total{allocator=\"host_metrics\"} 2"), std::string::npos);
+  ASSERT_NE(prometheus.str().find("umpire_allocation_size_bytes_bucket{allocator=\"host_metrics\",le=\"128\"} 1"),
+            std::string::npos);
+}
+
+TEST(AllocationProfiler, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  // Sample every allocation
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::AllocationProfiler>("host_profiler", rm.getAllocator("HOST"), 1);
+  auto profiler = umpire::util::unwrap_allocator<umpire::strategy::AllocationProfiler>(allocator);
+
+  std::vector<void*> ptrs;
+  for (int i = 0; i < 3; ++i) {
+    ptrs.push_back(allocator.allocate(1024));
+  }
+  ptrs.push_back(allocator.allocate(2048));
+
+  ASSERT_EQ(profiler->getNumLiveSamples(), 4);
+
+  allocator.deallocate(ptrs.back());
+  ptrs.pop_back();
+
+  ASSERT_EQ(profiler->getNumLiveSamples(), 3);
+
+  std::stringstream heap;
+  profiler->dumpHeapProfile(heap);
+  ASSERT_EQ(heap.str().find("heap profile: 3: 3072 [4: 5120] @ heap_v2/1\n"), 0);
+  // Allocations from the same call site share a stack
+  ASSERT_NE(heap.str().find("\n3: 3072 [3: 3072] @ "), std::string::npos);
+  ASSERT_NE(heap.str().find("\n0: 0 [1: 2048] @ "), std::string::npos);
+
+  std::stringstream peak;
+  profiler->dumpPeakHeapProfile(peak);
+  ASSERT_EQ(peak.str().find("heap profile: 4: 5120 [4: 5120] @ heap_v2/1\n"), 0);
+  // Each stack is reported as it was at the peak
+  ASSERT_NE(peak.str().find("\n3: 3072 [3: 3072] @ "), std::string::npos);
+  ASSERT_NE(peak.str().find("\n1: 2048 [1: 2048] @ "), std::string::npos);
+
+  for (auto ptr : ptrs) {
+    allocator.deallocate(ptr);
+  }
+
+  ASSERT_EQ(profiler->getNumLiveSamples(), 0);
+
+  // The peak stays until it is exceeded, and then covers only the new stack
+  std::stringstream old_peak;
+  profiler->dumpPeakHeapProfile(old_peak);
+  const auto profile = [](const std::stringstream& dump) { return dump.str().substr(0, dump.str().find("\nMAPPED")); };
+  ASSERT_EQ(profile(old_peak), profile(peak));
+
+  void* large = allocator.allocate(8192);
+  std::stringstream new_peak;
+  profiler->dumpPeakHeapProfile(new_peak);
+  ASSERT_EQ(new_peak.str().find("heap profile: 1: 8192 [1: 8192] @ heap_v2/1\n"), 0);
+  ASSERT_EQ(new_peak.str().find("\n3: 3072 [3: 3072] @ "), std::string::npos);
+  allocator.deallocate(large);
+}
+
+#if defined(UMPIRE_ENABLE_FILE_RESOURCE)
+TEST(OutOfCoreAllocator, SpillAndRestore)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block_size{64 * 1024};
+  const std::size_t limit{4 * block_size};
+  const int N{8};
+
+  auto allocator = rm.makeAllocator<umpire::strategy::OutOfCoreAllocator>("host_out_of_core", rm.getAllocator("HOST"),
+                                                                          limit);
+  auto out_of_core = umpire::util::unwrap_allocator<umpire::strategy::OutOfCoreAllocator>(allocator);
+
+  std::vector<int*> allocs(N);
+  const std::size_t n{block_size / sizeof(int)};
+
+  for (int i = 0; i < N; i++) {
+    allocs[i] = static_cast<int*>(allocator.allocate(block_size));
+    for (std::size_t j = 0; j < n; j++) {
+      allocs[i][j] = i;
+    }
+  }
+
+  // The least recently used allocations were moved to the file
+  ASSERT_EQ(out_of_core->getResidentSize(), limit);
+  ASSERT_EQ(out_of_core->getSpilledSize(), (N * block_size) - limit);
+  ASSERT_TRUE(out_of_core->isSpilled(allocs[0]));
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[N - 1]));
+
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ(allocs[i][0], i);
+    ASSERT_EQ(allocs[i][n - 1], i);
+  }
+
+  // Touching a spilled allocation brings it back in place of the coldest one
+  out_of_core->touch(allocs[0]);
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[0]));
+  ASSERT_TRUE(out_of_core->isSpilled(allocs[N - 4]));
+  ASSERT_EQ(out_of_core->getResidentSize(), limit);
+
+  for (std::size_t j = 0; j < n; j++) {
+    ASSERT_EQ(allocs[0][j], 0);
+  }
+
+  // Allocations larger than the limit live in the file
+  // and leave the resident allocations alone, even when touched
+  void* big = allocator.allocate(2 * limit);
+  ASSERT_TRUE(out_of_core->isSpilled(big));
+  ASSERT_EQ(out_of_core->getResidentSize(), limit);
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[0]));
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[N - 1]));
+
+  out_of_core->touch(big);
+  ASSERT_TRUE(out_of_core->isSpilled(big));
+  ASSERT_EQ(out_of_core->getResidentSize(), limit);
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[0]));
+  ASSERT_FALSE(out_of_core->isSpilled(allocs[N - 1]));
+
+  allocator.deallocate(big);
+
+  for (auto alloc : allocs) {
+    allocator.deallocate(alloc);
+  }
+
+  ASSERT_EQ(out_of_core->getResidentSize(), 0);
+  ASSERT_EQ(out_of_core->getSpilledSize(), 0);
+}
+
+TEST(OutOfCoreAllocator, OnlyOverHostResource)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  // Allocations never come from the allocator, so a pool would have no effect
+  auto pool = rm.makeAllocator<umpire::strategy::QuickPool>("host_out_of_core_pool", rm.getAllocator("HOST"));
+  EXPECT_THROW(rm.makeAllocator<umpire::strategy::OutOfCoreAllocator>("host_out_of_core_over_pool", pool, 4096),
+               umpire::util::Exception);
+  EXPECT_THROW(rm.makeAllocator<umpire::strategy::OutOfCoreAllocator>("host_out_of_core_over_file",
+                                                                      rm.getAllocator("FILE"), 4096),
+               umpire::util::Exception);
+}
+#endif // defined(UMPIRE_ENABLE_FILE_RESOURCE)
+
 #if defined(UMPIRE_ENABLE_NUMA)
 TEST(NumaPolicyTest, EdgeCases)
 {
@@ -743,3 +1607,103 @@ TEST(AlignedAllocator, BadAlignment)
       },
       umpire::util::Exception);
 }
+
+TEST(AlignedAllocator, OverQuickPool)
+{
+  const unsigned int align = 4096;
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto pool = rm.makeAllocator<umpire::strategy::QuickPool>("aligned_quick_pool", rm.getAllocator("HOST"), 1024 * 1024);
+  auto alloc = rm.makeAllocator<umpire::strategy::AlignedAllocator>("aligned_allocator_quick_pool", pool, align);
+
+  std::vector<void*> ptrs;
+  for (int i = 0; i < 64; ++i) {
+    void* ptr{alloc.allocate(100)};
+    test_alignment(reinterpret_cast<uintptr_t>(ptr), align);
+    ptrs.push_back(ptr);
+  }
+
+  // Without padding, 64 of these fit in the first block
+  ASSERT_EQ(pool.getActualSize(), 1024 * 1024);
+  ASSERT_EQ(alloc.getCurrentSize(), 64 * 100);
+
+  for (auto ptr : ptrs) {
+    alloc.deallocate(ptr);
+  }
+  ASSERT_EQ(pool.getCurrentSize(), 0);
+
+  void* ptr{alloc.allocate(100)};
+  test_alignment(reinterpret_cast<uintptr_t>(ptr), align);
+  ASSERT_EQ(pool.getActualSize(), 1024 * 1024);
+  alloc.deallocate(ptr);
+
+  pool.release();
+  ASSERT_EQ(pool.getActualSize(), 0);
+}
+
+TEST(AlignedAllocator, OverDynamicPoolList)
+{
+  const unsigned int align = 4096;
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto pool = rm.makeAllocator<umpire::strategy::DynamicPoolList>("aligned_dynamic_pool_list",
+                                                                  rm.getAllocator("HOST"), 1024 * 1024);
+  auto alloc = rm.makeAllocator<umpire::strategy::AlignedAllocator>("aligned_allocator_dynamic_pool_list", pool, align);
+
+  std::vector<void*> ptrs;
+  for (int i = 0; i < 64; ++i) {
+    void* ptr{alloc.allocate(100)};
+    test_alignment(reinterpret_cast<uintptr_t>(ptr), align);
+    ptrs.push_back(ptr);
+  }
+
+  ASSERT_EQ(pool.getActualSize(), 1024 * 1024);
+
+  for (auto ptr : ptrs) {
+    alloc.deallocate(ptr);
+  }
+  ASSERT_EQ(pool.getCurrentSize(), 0);
+
+  pool.release();
+  ASSERT_EQ(pool.getActualSize(), 0);
+}
+
+TEST(AlignedAllocator, OverFixedPool)
+{
+  const unsigned int align = 512;
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto quick_pool = rm.makeAllocator<umpire::strategy::QuickPool>("aligned_fixed_pool_parent", rm.getAllocator("HOST"));
+  auto pool = rm.makeAllocator<umpire::strategy::FixedPool>("aligned_fixed_pool", quick_pool, 256, 64);
+  auto alloc = rm.makeAllocator<umpire::strategy::AlignedAllocator>("aligned_allocator_fixed_pool", pool, align);
+
+  std::vector<void*> ptrs;
+  for (int i = 0; i < 32; ++i) {
+    void* ptr{alloc.allocate(16 * (i % 16 + 1))};
+    test_alignment(reinterpret_cast<uintptr_t>(ptr), align);
+    ptrs.push_back(ptr);
+  }
+
+  // Every other object is aligned, so that used all of them in the first
+  // sub-pool
+  auto fixed_pool = umpire::util::unwrap_allocator<umpire::strategy::FixedPool>(pool);
+  ASSERT_EQ(fixed_pool->getCurrentSize(), 32 * 256);
+  ASSERT_EQ(fixed_pool->numPools(), 1);
+
+  EXPECT_THROW(alloc.allocate(257), umpire::util::Exception);
+
+  for (auto ptr : ptrs) {
+    alloc.deallocate(ptr);
+  }
+  ASSERT_EQ(fixed_pool->getCurrentSize(), 0);
+
+  // Only one in 256 objects of 48 bytes may be aligned to 4096, which a
+  // sub-pool of 64 need not hold, so the pool does not grow trying
+  auto odd_pool = rm.makeAllocator<umpire::strategy::FixedPool>("aligned_fixed_pool_odd", quick_pool, 48, 64);
+  auto odd_alloc =
+      rm.makeAllocator<umpire::strategy::AlignedAllocator>("aligned_allocator_fixed_pool_odd", odd_pool, 4096);
+  auto odd_fixed_pool = umpire::util::unwrap_allocator<umpire::strategy::FixedPool>(odd_pool);
+  const std::size_t actual_size{odd_pool.getActualSize()};
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_THROW(odd_alloc.allocate(48), umpire::util::Exception);
+  }
+  ASSERT_EQ(odd_fixed_pool->numPools(), 1);
+  ASSERT_EQ(odd_pool.getActualSize(), actual_size);
+}
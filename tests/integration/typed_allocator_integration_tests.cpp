@@ -4,8 +4,12 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <list>
+#include <map>
+
 #include "gtest/gtest.h"
 #include "umpire/ResourceManager.hpp"
+#include "umpire/SlabTypedAllocator.hpp"
 #include "umpire/TypedAllocator.hpp"
 #include "umpire/Umpire.hpp"
 #include "umpire/config.hpp"
@@ -206,3 +210,73 @@ TEST(TypedAllocation, EqualityDifferentTypeDifferent)
 
   ASSERT_TRUE((alloc_two != alloc_one));
 }
+
+TEST(SlabTypedAllocation, Containers)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto allocator = rm.makeAllocator<umpire::strategy::SizeLimiter>("SlabContainersLimiter", rm.getAllocator("HOST"),
+                                                                   64 * 1024 * 1024);
+
+  const int num_nodes{10000};
+
+  {
+    umpire::SlabTypedAllocator<std::pair<const int, double>> slab_allocator{allocator};
+
+    std::map<int, double, std::less<int>, umpire::SlabTypedAllocator<std::pair<const int, double>>> map{
+        slab_allocator};
+    std::list<int, umpire::SlabTypedAllocator<int>> list{slab_allocator};
+
+    for (int i = 0; i < num_nodes; ++i) {
+      map[i] = i;
+      list.push_back(i);
+    }
+
+    // Only the slabs are allocated from the Allocator
+    ASSERT_LT(allocator.getAllocationCount(), static_cast<std::size_t>(num_nodes / 100));
+    ASSERT_GE(allocator.getCurrentSize(), 2 * num_nodes * sizeof(int));
+
+    // Freed nodes are reused before carving new ones
+    const std::size_t size{allocator.getCurrentSize()};
+    map.clear();
+    list.clear();
+    for (int i = 0; i < num_nodes; ++i) {
+      map[i] = i;
+      list.push_back(i);
+    }
+    ASSERT_EQ(allocator.getCurrentSize(), size);
+  }
+
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
+TEST(SlabTypedAllocation, LargeAllocations)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto allocator = rm.getAllocator("HOST");
+
+  umpire::SlabTypedAllocator<double> slab_allocator{allocator};
+
+  double* data = slab_allocator.allocate(1024);
+  ASSERT_EQ(allocator.getSize(data), 1024 * sizeof(double));
+  slab_allocator.deallocate(data, 1024);
+}
+
+TEST(SlabTypedAllocation, Equality)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  umpire::SlabTypedAllocator<double> alloc_one(rm.getAllocator("HOST"));
+  umpire::SlabTypedAllocator<char> alloc_copy(alloc_one);
+  umpire::SlabTypedAllocator<double> alloc_two(rm.getAllocator("HOST"));
+
+  ASSERT_TRUE((alloc_one == alloc_copy));
+  ASSERT_FALSE((alloc_one != alloc_copy));
+
+  // Each instance has its own slabs
+  ASSERT_FALSE((alloc_one == alloc_two));
+  ASSERT_TRUE((alloc_one != alloc_two));
+
+  char* data = alloc_copy.allocate(1);
+  ASSERT_NE(nullptr, data);
+  alloc_copy.deallocate(data, 1);
+}
@@ -11,7 +11,10 @@
 
 #include "gtest/gtest.h"
 #include "resource_tests.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/Umpire.hpp"
 #include "umpire/resource/FileMemoryResource.hpp"
+#include "umpire/resource/PersistentFileMemoryResource.hpp"
 #include "umpire/util/Exception.hpp"
 
 TYPED_TEST_P(ResourceTest, AllocateDeallocate)
@@ -65,7 +68,161 @@ TYPED_TEST_P(ResourceTest, MmapFile)
   this->memory_resource->deallocate(ptr, 1000000000ULL * sizeof(std::size_t));
 }
 
+TYPED_TEST_P(ResourceTest, SubAllocate)
+{
+  constexpr int N = 64;
+  std::size_t* ptrs[N];
+
+  for (int i = 0; i < N; i++) {
+    ptrs[i] = static_cast<std::size_t*>(this->memory_resource->allocate((i + 1) * 1000));
+    ASSERT_NE(ptrs[i], nullptr);
+    ptrs[i][0] = i;
+  }
+
+  // All of the allocations come from the first extent of the same file
+  const auto actual_size = this->memory_resource->getActualSize();
+  ASSERT_GE(actual_size, 64 * 1024 * 1024);
+
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ(ptrs[i][0], static_cast<std::size_t>(i));
+  }
+
+  for (int i = 0; i < N; i += 2) {
+    this->memory_resource->deallocate(ptrs[i], (i + 1) * 1000);
+  }
+  for (int i = 1; i < N; i += 2) {
+    this->memory_resource->deallocate(ptrs[i], (i + 1) * 1000);
+  }
+
+  // Freed blocks are merged and reused without growing the file
+  void* ptr = this->memory_resource->allocate(N * 1000);
+  ASSERT_EQ(ptr, ptrs[0]);
+  ASSERT_EQ(this->memory_resource->getActualSize(), actual_size);
+
+  this->memory_resource->deallocate(ptr, N * 1000);
+  ASSERT_NO_THROW(this->memory_resource->release());
+}
+
+TYPED_TEST_P(ResourceTest, Shrink)
+{
+  constexpr std::size_t extent_size{umpire::resource::FileMemoryResource::s_min_extent_size};
+
+  void* small = this->memory_resource->allocate(1000);
+  const auto actual_size = this->memory_resource->getActualSize();
+
+  void* large = this->memory_resource->allocate(4 * extent_size);
+  ASSERT_GT(this->memory_resource->getActualSize(), 4 * extent_size);
+
+  // The free end of the file is truncated, keeping one extent of slack
+  this->memory_resource->deallocate(large, 4 * extent_size);
+  ASSERT_LE(this->memory_resource->getActualSize(), actual_size + extent_size);
+
+  // Freeing a block that does not end the file keeps the file as it is
+  const auto shrunk_size = this->memory_resource->getActualSize();
+  this->memory_resource->deallocate(small, 1000);
+  ASSERT_EQ(this->memory_resource->getActualSize(), shrunk_size);
+
+  large = this->memory_resource->allocate(4 * extent_size);
+  ASSERT_NE(large, nullptr);
+  static_cast<char*>(large)[4 * extent_size - 1] = 'x';
+  this->memory_resource->deallocate(large, 4 * extent_size);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(ResourceTest, Constructor, Allocate, getCurrentSize, getHighWatermark, getPlatform,
-                            getTraits, AllocateDeallocate, ZeroFile, LargeFile, MmapFile);
+                            getTraits, AllocateDeallocate, ZeroFile, LargeFile, MmapFile, SubAllocate, Shrink);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Mmap, ResourceTest, umpire::resource::FileMemoryResource, );
+
+static std::string persistent_file_name(const std::string& name)
+{
+  return "umpire_persistent_" + name + "_" + std::to_string(getpid());
+}
+
+TEST(PersistentFileMemoryResource, Reopen)
+{
+  const std::string name{"FILE::" + persistent_file_name("reopen")};
+  auto traits = umpire::MemoryResourceTraits{};
+  traits.size = 16 * 1024 * 1024;
+
+  const std::size_t N{1000};
+  std::size_t actual_size{0};
+  std::string filename;
+
+  {
+    umpire::resource::PersistentFileMemoryResource resource{umpire::Platform::undefined, name, 0, traits};
+    filename = resource.getFilename();
+
+    double* data = static_cast<double*>(resource.allocate_named("data", N * sizeof(double)));
+    for (std::size_t i = 0; i < N; i++) {
+      data[i] = static_cast<double>(i);
+    }
+
+    actual_size = resource.getActualSize();
+    void* scratch = resource.allocate(4096);
+    ASSERT_NE(scratch, nullptr);
+    ASSERT_GT(resource.getActualSize(), actual_size);
+
+    ASSERT_NO_THROW(resource.sync());
+  }
+
+  {
+    umpire::resource::PersistentFileMemoryResource resource{umpire::Platform::undefined, name, 0, traits};
+
+    // Named allocations survive, unnamed ones are reclaimed
+    ASSERT_EQ(resource.getActualSize(), actual_size);
+
+    double* data = static_cast<double*>(resource.find_pointer_from_name("data"));
+    ASSERT_NE(data, nullptr);
+    for (std::size_t i = 0; i < N; i++) {
+      ASSERT_EQ(data[i], static_cast<double>(i));
+    }
+
+    ASSERT_EQ(resource.allocate_named("data", N * sizeof(double)), data);
+    ASSERT_THROW(resource.allocate_named("data", 2 * N * sizeof(double)), umpire::util::Exception);
+    ASSERT_EQ(resource.find_pointer_from_name("missing"), nullptr);
+
+    resource.deallocate(data, N * sizeof(double));
+    ASSERT_EQ(resource.find_pointer_from_name("data"), nullptr);
+  }
+
+  ASSERT_EQ(remove(filename.c_str()), 0);
+}
+
+TEST(PersistentFileMemoryResource, Locked)
+{
+  const std::string name{"FILE::" + persistent_file_name("locked")};
+  auto traits = umpire::MemoryResourceTraits{};
+  traits.size = 1024 * 1024;
+
+  std::string filename;
+  {
+    umpire::resource::PersistentFileMemoryResource resource{umpire::Platform::undefined, name, 0, traits};
+    filename = resource.getFilename();
+
+    ASSERT_THROW(umpire::resource::PersistentFileMemoryResource(umpire::Platform::undefined, name, 1, traits),
+                 umpire::util::Exception);
+  }
+
+  ASSERT_EQ(remove(filename.c_str()), 0);
+}
+
+TEST(PersistentFileMemoryResource, ResourceManager)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::string name{"FILE::" + persistent_file_name("rm")};
+  auto traits = umpire::get_default_resource_traits("FILE");
+  traits.size = 1024 * 1024;
+
+  auto allocator = rm.makeResource(name, traits);
+  void* ptr = allocator.allocate("buffer", 1024);
+
+  ASSERT_EQ(umpire::find_pointer_from_name(allocator, "buffer"), ptr);
+
+  allocator.deallocate(ptr);
+  ASSERT_EQ(umpire::find_pointer_from_name(allocator, "buffer"), nullptr);
+
+  auto resource = dynamic_cast<umpire::resource::PersistentFileMemoryResource*>(allocator.getAllocationStrategy());
+  ASSERT_NE(resource, nullptr);
+  ASSERT_EQ(remove(resource->getFilename().c_str()), 0);
+}
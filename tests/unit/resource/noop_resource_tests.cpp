@@ -0,0 +1,44 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "gtest/gtest.h"
+#include "resource_tests.hpp"
+#include "umpire/resource/NoOpMemoryResource.hpp"
+
+TYPED_TEST_P(ResourceTest, NoOpSizes)
+{
+  void* first = this->memory_resource->allocate(64);
+  void* second = this->memory_resource->allocate(1024);
+
+  ASSERT_NE(first, second);
+  ASSERT_EQ(this->memory_resource->getCurrentSize(), 64 + 1024);
+  ASSERT_EQ(this->memory_resource->getHighWatermark(), 64 + 1024);
+  ASSERT_EQ(this->memory_resource->getNumAllocations(), 2);
+
+  this->memory_resource->deallocate(second, 1024);
+
+  ASSERT_EQ(this->memory_resource->getCurrentSize(), 64);
+  ASSERT_EQ(this->memory_resource->getHighWatermark(), 64 + 1024);
+  ASSERT_EQ(this->memory_resource->getNumDeallocations(), 1);
+
+  void* third = this->memory_resource->allocate(16);
+
+  ASSERT_EQ(this->memory_resource->getCurrentSize(), 64 + 16);
+  ASSERT_EQ(this->memory_resource->getHighWatermark(), 64 + 1024);
+
+  this->memory_resource->deallocate(first, 64);
+  this->memory_resource->deallocate(third, 16);
+
+  ASSERT_EQ(this->memory_resource->getCurrentSize(), 0);
+  ASSERT_EQ(this->memory_resource->getHighWatermark(), 64 + 1024);
+  ASSERT_EQ(this->memory_resource->getNumAllocations(), 3);
+  ASSERT_EQ(this->memory_resource->getNumDeallocations(), 3);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceTest, Constructor, Allocate, getCurrentSize, getHighWatermark, getPlatform,
+                            getTraits, NoOpSizes);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(NoOp, ResourceTest, umpire::resource::NoOpMemoryResource, );
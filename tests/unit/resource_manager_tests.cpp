@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
 #include "gtest/gtest.h"
+#include "umpire/AllocatorHandle.hpp"
 #include "umpire/ResourceManager.hpp"
 #include "umpire/strategy/NamedAllocationStrategy.hpp"
 
@@ -100,3 +101,31 @@ TEST(ResourceManager, aliases)
 
   EXPECT_THROW({ rm.removeAlias("NAMED_ALLOCATOR", named_alloc); }, umpire::util::Exception);
 }
+
+TEST(ResourceManager, AllocatorHandle)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto host = rm.getAllocator("HOST");
+  auto named = rm.makeAllocator<umpire::strategy::NamedAllocationStrategy>("HANDLE_ALLOCATOR", host);
+
+  rm.addAlias("HANDLE_ALIAS", host);
+
+  umpire::AllocatorHandle handle{"HANDLE_ALIAS"};
+  EXPECT_EQ(handle.getName(), "HANDLE_ALIAS");
+  EXPECT_EQ(handle.get().getId(), host.getId());
+
+  umpire::AllocatorHandle copy{handle};
+  EXPECT_EQ(copy.get().getId(), host.getId());
+
+  // The handle follows the alias when it is moved to another allocator
+  rm.removeAlias("HANDLE_ALIAS", host);
+  rm.addAlias("HANDLE_ALIAS", named);
+  EXPECT_EQ(handle.get().getId(), named.getId());
+  EXPECT_EQ(copy.get().getId(), named.getId());
+
+  rm.removeAlias("HANDLE_ALIAS", named);
+  EXPECT_THROW(handle.get(), umpire::util::Exception);
+
+  EXPECT_THROW(umpire::AllocatorHandle{"BANANA"}, umpire::util::Exception);
+}
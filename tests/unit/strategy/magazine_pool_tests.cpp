@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/strategy/MagazineDynamicSizePool.hpp"
+#include "umpire/strategy/MagazineFixedSizePool.hpp"
+
+struct Object {
+  std::size_t values[8];
+};
+
+using ObjectPool = MagazineFixedSizePool<Object, StdAllocator>;
+
+static const int s_num_threads{8};
+
+TEST(MagazineFixedSizePool, Reuse)
+{
+  ObjectPool pool;
+
+  Object* first{pool.allocate()};
+  pool.deallocate(first);
+
+  EXPECT_EQ(first, pool.allocate());
+  EXPECT_EQ(pool.getCurrentSize(), sizeof(Object));
+
+  pool.deallocate(first);
+}
+
+TEST(MagazineFixedSizePool, DepotLimit)
+{
+  ObjectPool pool{4, 1};
+
+  std::vector<Object*> objects;
+  for (int i = 0; i < 100; i++) {
+    objects.push_back(pool.allocate());
+  }
+  for (auto object : objects) {
+    pool.deallocate(object);
+  }
+
+  // Two magazines held by this thread and one in the depot
+  EXPECT_EQ(pool.getCurrentSize(), 12 * sizeof(Object));
+
+  pool.release();
+  EXPECT_EQ(pool.getCurrentSize(), 8 * sizeof(Object));
+}
+
+TEST(MagazineFixedSizePool, Threads)
+{
+  ObjectPool pool{16, 4};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < s_num_threads; t++) {
+    threads.emplace_back([&pool, t]() {
+      for (int round = 0; round < 100; round++) {
+        std::vector<Object*> objects;
+        for (int i = 0; i < 50; i++) {
+          Object* object{pool.allocate()};
+          object->values[0] = t;
+          objects.push_back(object);
+        }
+        for (auto object : objects) {
+          ASSERT_EQ(object->values[0], static_cast<std::size_t>(t));
+          pool.deallocate(object);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // The magazines of the exited threads have moved to the depot
+  pool.release();
+  EXPECT_EQ(pool.getCurrentSize(), 0);
+}
+
+TEST(MagazineDynamicSizePool, Classes)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  MagazineDynamicSizePool<> pool{rm.getAllocator("HOST").getAllocationStrategy()};
+
+  void* small{pool.allocate(20)};
+  EXPECT_EQ(pool.getCurrentSize(), 32);
+  pool.deallocate(small, 20);
+
+  // Any size in the same class reuses it
+  EXPECT_EQ(small, pool.allocate(30));
+  pool.deallocate(small, 30);
+
+  void* large{pool.allocate(4096)};
+  EXPECT_EQ(pool.getCurrentSize(), 32 + 4096);
+  pool.deallocate(large, 4096);
+  EXPECT_EQ(pool.getCurrentSize(), 32);
+
+  pool.release();
+  EXPECT_EQ(pool.getCurrentSize(), 32);
+}
+
+TEST(MagazineDynamicSizePool, Threads)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  MagazineDynamicSizePool<> pool{rm.getAllocator("HOST").getAllocationStrategy(), 1024 * 1024, 1024, 16, 256, 8, 2};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < s_num_threads; t++) {
+    threads.emplace_back([&pool, t]() {
+      for (int round = 0; round < 100; round++) {
+        std::vector<std::pair<char*, std::size_t>> allocations;
+        for (std::size_t i = 0; i < 40; i++) {
+          const std::size_t bytes{1 + (i * 37 + round) % 512};
+          char* ptr{static_cast<char*>(pool.allocate(bytes))};
+          ptr[0] = ptr[bytes - 1] = static_cast<char>(t);
+          allocations.emplace_back(ptr, bytes);
+        }
+        for (auto& allocation : allocations) {
+          ASSERT_EQ(allocation.first[0], static_cast<char>(t));
+          ASSERT_EQ(allocation.first[allocation.second - 1], static_cast<char>(t));
+          pool.deallocate(allocation.first, allocation.second);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  pool.release();
+  EXPECT_EQ(pool.getCurrentSize(), 0);
+  EXPECT_EQ(pool.getActualSize(), 0);
+}
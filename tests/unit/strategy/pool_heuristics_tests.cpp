@@ -5,8 +5,12 @@
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -119,3 +123,179 @@ TYPED_TEST(PoolHeuristicsTest, BlocksReleasable)
   ASSERT_EQ(a.second->getReleasableBlocks(), 1);
   ASSERT_EQ(a.second->getTotalBlocks(), 1);
 }
+
+TYPED_TEST(PoolHeuristicsTest, IdleReleasable)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  const int max_blocks{4};
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::idle_releasable(std::chrono::hours{1})););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (auto ptr : ptrs) {
+      ASSERT_NO_THROW(a.first.deallocate(ptr););
+    }
+
+    ASSERT_EQ(a.second->getReleasableBlocks(), max_blocks);
+    ASSERT_EQ(a.second->getTotalBlocks(), max_blocks);
+  }
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::idle_releasable(std::chrono::milliseconds{0})););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (int i{max_blocks}; i > 0; i--) {
+      ASSERT_NO_THROW(a.first.deallocate(ptrs[i - 1]););
+      ASSERT_EQ(a.second->getReleasableBlocks(), 0);
+      ASSERT_EQ(a.second->getTotalBlocks(), i - 1);
+    }
+
+    ASSERT_EQ(a.second->getActualSize(), 0);
+  }
+}
+
+TYPED_TEST(PoolHeuristicsTest, PressureReleasable)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  const int max_blocks{4};
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::pressure_releasable(0)););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (auto ptr : ptrs) {
+      ASSERT_NO_THROW(a.first.deallocate(ptr););
+    }
+
+    ASSERT_EQ(a.second->getTotalBlocks(), max_blocks);
+  }
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::pressure_releasable(
+                        std::numeric_limits<std::size_t>::max(), std::chrono::milliseconds{0})););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (auto ptr : ptrs) {
+      ASSERT_NO_THROW(a.first.deallocate(ptr););
+      ASSERT_EQ(a.second->getReleasableBlocks(), 0);
+    }
+
+    ASSERT_EQ(a.second->getTotalBlocks(), 0);
+    ASSERT_EQ(a.second->getActualSize(), 0);
+  }
+}
+
+TYPED_TEST(PoolHeuristicsTest, HwmReleasable)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  const int max_blocks{4};
+
+  ASSERT_THROW(myPoolType::hwm_releasable(0), umpire::util::Exception);
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::hwm_releasable(1)););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (int i{max_blocks}; i > 0; i--) {
+      ASSERT_NO_THROW(a.first.deallocate(ptrs[i - 1]););
+      ASSERT_EQ(a.second->getActualSize(), a.second->getCurrentSize());
+    }
+
+    ASSERT_EQ(a.second->getTotalBlocks(), 0);
+  }
+
+  {
+    TestAllocator a;
+    ASSERT_NO_THROW(a = this->getAllocator(myPoolType::hwm_releasable(100)););
+
+    std::vector<void*> ptrs;
+    for (int i{0}; i < max_blocks; i++) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+    }
+
+    for (int i{max_blocks}; i > 0; i--) {
+      ASSERT_NO_THROW(a.first.deallocate(ptrs[i - 1]););
+    }
+
+    //
+    // Only the block above the high-water mark of the window is returned
+    //
+    ASSERT_EQ(a.second->getTotalBlocks(), max_blocks - 1);
+    ASSERT_EQ(a.second->getActualSize(), (max_blocks - 1) * this->first_block);
+  }
+}
+
+TYPED_TEST(PoolHeuristicsTest, DecommitReleasable)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  const int max_blocks{4};
+  const std::size_t block_size{1024 * 1024};
+
+  TestAllocator a;
+  ASSERT_NO_THROW(a = this->getAllocator(myPoolType::decommit_releasable(myPoolType::percent_releasable(100))););
+
+  std::vector<void*> ptrs;
+  for (int i{0}; i < max_blocks; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(block_size)););
+    std::memset(ptrs.back(), 0xFF, block_size);
+  }
+
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+  }
+
+  //
+  // Decommitting keeps the blocks in the pool. QuickPool remembers that the
+  // heuristic has decommitted them already.
+  //
+  ASSERT_EQ(a.second->getTotalBlocks(), max_blocks);
+  ASSERT_EQ(a.second->getActualSize(), max_blocks * block_size);
+  if (std::is_same<myPoolType, umpire::strategy::QuickPool>::value) {
+    ASSERT_EQ(a.second->decommit(), 0);
+  } else {
+    ASSERT_GE(a.second->decommit(), max_blocks * (block_size - 8192));
+  }
+
+  for (int i{0}; i < max_blocks; i++) {
+    void* ptr{nullptr};
+    ASSERT_NO_THROW(ptr = a.first.allocate(block_size););
+    std::memset(ptr, 0, block_size);
+    ptrs[i] = ptr;
+  }
+
+  ASSERT_EQ(a.second->getTotalBlocks(), max_blocks);
+
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+  }
+}
@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/AddressRangeIndex.hpp"
+#include "umpire/util/Exception.hpp"
+
+using umpire::strategy::AllocationStrategy;
+
+namespace {
+
+void* address(std::uintptr_t value)
+{
+  return reinterpret_cast<void*>(value);
+}
+
+AllocationStrategy* owner(std::uintptr_t value)
+{
+  return reinterpret_cast<AllocationStrategy*>(value);
+}
+
+} // namespace
+
+TEST(AddressRangeIndexTest, Find)
+{
+  umpire::util::AddressRangeIndex index;
+
+  index.insert(address(0x1000), 0x1000, owner(1));
+  index.insert(address(0x4000), 0x100, owner(2));
+
+  ASSERT_EQ(index.size(), 2);
+
+  ASSERT_EQ(index.find(address(0x1000)), owner(1));
+  ASSERT_EQ(index.find(address(0x1fff)), owner(1));
+  ASSERT_EQ(index.find(address(0x40ff)), owner(2));
+
+  ASSERT_EQ(index.find(address(0xfff)), nullptr);
+  ASSERT_EQ(index.find(address(0x2000)), nullptr);
+  ASSERT_EQ(index.find(address(0x4100)), nullptr);
+}
+
+TEST(AddressRangeIndexTest, Overlap)
+{
+  umpire::util::AddressRangeIndex index;
+
+  ASSERT_TRUE(index.insert(address(0x1000), 0x1000, owner(1)));
+
+  ASSERT_FALSE(index.insert(address(0x1800), 0x1000, owner(2)));
+  ASSERT_FALSE(index.insert(address(0x800), 0x1000, owner(2)));
+  // Nested ranges, as of a pool built on another pool, overlap too
+  ASSERT_FALSE(index.insert(address(0x1400), 0x100, owner(2)));
+  ASSERT_EQ(index.find(address(0x1400)), owner(1));
+  ASSERT_EQ(index.size(), 1);
+
+  ASSERT_TRUE(index.insert(address(0x2000), 0x1000, owner(2)));
+}
+
+TEST(AddressRangeIndexTest, Remove)
+{
+  umpire::util::AddressRangeIndex index;
+
+  index.insert(address(0x1000), 0x1000, owner(1));
+
+  ASSERT_THROW(index.remove(address(0x1800)), umpire::util::Exception);
+  ASSERT_NO_THROW(index.remove(address(0x1000)));
+
+  ASSERT_EQ(index.size(), 0);
+  ASSERT_EQ(index.find(address(0x1000)), nullptr);
+}
+
+TEST(AddressRangeIndexTest, Grow)
+{
+  umpire::util::AddressRangeIndex index;
+  const std::uintptr_t count{1000};
+
+  // Insert out of order, so that ranges are inserted in the middle
+  for (std::uintptr_t i = 0; i < count; ++i) {
+    const std::uintptr_t slot{(i * 7) % count};
+    index.insert(address(0x10000 + slot * 0x100), 0x80, owner(slot + 1));
+  }
+
+  for (std::uintptr_t slot = 0; slot < count; ++slot) {
+    ASSERT_EQ(index.find(address(0x10000 + slot * 0x100 + 0x7f)), owner(slot + 1));
+    ASSERT_EQ(index.find(address(0x10000 + slot * 0x100 + 0x80)), nullptr);
+  }
+}
+
+TEST(AddressRangeIndexTest, ConcurrentFind)
+{
+  umpire::util::AddressRangeIndex index;
+  index.insert(address(0x1000), 0x1000, owner(1));
+
+  std::atomic<bool> done{false};
+  std::atomic<bool> failed{false};
+
+  std::thread reader{[&]() {
+    while (!done.load()) {
+      if (index.find(address(0x1800)) != owner(1)) {
+        failed.store(true);
+      }
+    }
+  }};
+
+  for (std::uintptr_t i = 0; i < 1000; ++i) {
+    index.insert(address(0x100000 + i * 0x100), 0x100, owner(2));
+  }
+  for (std::uintptr_t i = 0; i < 1000; ++i) {
+    index.remove(address(0x100000 + i * 0x100));
+  }
+
+  done.store(true);
+  reader.join();
+
+  ASSERT_FALSE(failed.load());
+}
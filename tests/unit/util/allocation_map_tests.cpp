@@ -115,6 +115,51 @@ TEST_F(AllocationMapTest, RemoveAndUse)
   ASSERT_EQ(record, found_record);
 }
 
+TEST_F(AllocationMapTest, Erase)
+{
+  EXPECT_NO_THROW({
+    map.insert(data, record);
+    map.erase(data);
+  });
+
+  ASSERT_FALSE(map.contains(data));
+  ASSERT_EQ(map.size(), 0);
+
+  ASSERT_THROW(map.erase(data), umpire::util::Exception);
+}
+
+TEST_F(AllocationMapTest, InsertRemoveBulk)
+{
+  void* ptrs[3] = {data, data + 5, data + 10};
+  umpire::util::AllocationRecord bulk_record{nullptr, 5 * sizeof(double), nullptr};
+
+  ASSERT_NO_THROW(map.insert(ptrs, 3, bulk_record));
+  ASSERT_EQ(map.size(), 3);
+  ASSERT_EQ(map.find(data + 7)->ptr, data + 5);
+
+  umpire::util::AllocationRecord records[3];
+  ASSERT_NO_THROW(map.remove(ptrs, 3, records));
+  ASSERT_EQ(map.size(), 0);
+
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(records[i].ptr, ptrs[i]);
+    ASSERT_EQ(records[i].size, 5 * sizeof(double));
+  }
+}
+
+TEST_F(AllocationMapTest, RemoveBulkNotFound)
+{
+  void* ptrs[2] = {data, data + 5};
+  umpire::util::AllocationRecord records[2];
+
+  map.insert(data, record);
+
+  // Nothing is removed when one of the pointers is not found
+  ASSERT_THROW(map.remove(ptrs, 2, records), umpire::util::Exception);
+  ASSERT_EQ(map.size(), 1);
+  ASSERT_EQ(map.find(data)->size, size);
+}
+
 TEST_F(AllocationMapTest, RegisterMultiple)
 {
   umpire::util::AllocationRecord next_record{data, 1, nullptr};
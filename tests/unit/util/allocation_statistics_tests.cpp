@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/AllocationRecord.hpp"
+#include "umpire/util/allocation_statistics.hpp"
+
+TEST(AllocationStatistics, RecordFragmentation)
+{
+  char buffer[1024];
+  std::vector<umpire::util::AllocationRecord> records;
+
+  ASSERT_FLOAT_EQ(umpire::util::relative_fragmentation(records), 0.0f);
+
+  records.push_back(umpire::util::AllocationRecord{buffer, 128, nullptr});
+  ASSERT_FLOAT_EQ(umpire::util::relative_fragmentation(records), 0.0f);
+
+  // Gaps of 128 and 384 bytes
+  records.push_back(umpire::util::AllocationRecord{buffer + 256, 128, nullptr});
+  records.push_back(umpire::util::AllocationRecord{buffer + 768, 256, nullptr});
+
+  ASSERT_NEAR(umpire::util::relative_fragmentation(records), 1.0f - 384.0f / 512.0f, 1e-6);
+}
+
+TEST(AllocationStatistics, FreeBlockStatistics)
+{
+  umpire::util::FreeBlockStatistics stats;
+
+  ASSERT_EQ(umpire::util::FreeBlockStatistics::bin(1), 0);
+  ASSERT_EQ(umpire::util::FreeBlockStatistics::bin(1023), 9);
+  ASSERT_EQ(umpire::util::FreeBlockStatistics::bin(1024), 10);
+
+  stats.insert(1024);
+  stats.insert(3072);
+  stats.insert(1500);
+  stats.erase(3072);
+
+  ASSERT_EQ(stats.free_blocks, 2);
+  ASSERT_EQ(stats.total_free, 2524);
+  ASSERT_EQ(stats.histogram[10], 2);
+  ASSERT_EQ(stats.histogram[11], 0);
+
+  stats.largest_free = 1500;
+  ASSERT_NEAR(umpire::util::relative_fragmentation(stats), 1.0f - 1500.0f / 2524.0f, 1e-6);
+}
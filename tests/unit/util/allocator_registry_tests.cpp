@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/AllocatorRegistry.hpp"
+
+using umpire::strategy::AllocationStrategy;
+using umpire::util::AllocatorRegistry;
+
+namespace {
+
+AllocationStrategy* strategy(std::uintptr_t value)
+{
+  return reinterpret_cast<AllocationStrategy*>(value);
+}
+
+} // namespace
+
+TEST(AllocatorRegistryTest, Find)
+{
+  AllocatorRegistry registry;
+
+  ASSERT_EQ(registry.find("HOST"), nullptr);
+  ASSERT_EQ(registry.find(0), nullptr);
+
+  registry.update([](AllocatorRegistry::Snapshot& snapshot) {
+    snapshot.names["HOST"] = strategy(0x10);
+    snapshot.names["HOST_ALIAS"] = strategy(0x10);
+    snapshot.ids[0] = strategy(0x10);
+  });
+
+  ASSERT_EQ(registry.find("HOST"), strategy(0x10));
+  ASSERT_EQ(registry.find("HOST_ALIAS"), strategy(0x10));
+  ASSERT_EQ(registry.find(0), strategy(0x10));
+  ASSERT_EQ(registry.find("DEVICE"), nullptr);
+  ASSERT_EQ(registry.find(1), nullptr);
+
+  auto snapshot = registry.copy();
+  ASSERT_EQ(snapshot.names.size(), 2);
+  ASSERT_EQ(snapshot.ids.size(), 1);
+}
+
+TEST(AllocatorRegistryTest, Update)
+{
+  AllocatorRegistry registry;
+  const std::size_t version{registry.version()};
+
+  registry.update([](AllocatorRegistry::Snapshot& snapshot) { snapshot.names["A"] = strategy(0x10); });
+  ASSERT_EQ(registry.version(), version + 1);
+
+  registry.update([](AllocatorRegistry::Snapshot& snapshot) { snapshot.names.erase("A"); });
+  ASSERT_EQ(registry.version(), version + 2);
+  ASSERT_EQ(registry.find("A"), nullptr);
+
+  // A failed update publishes nothing
+  ASSERT_THROW(registry.update([](AllocatorRegistry::Snapshot& snapshot) {
+    snapshot.names["B"] = strategy(0x20);
+    throw std::runtime_error{"failed"};
+  }),
+               std::runtime_error);
+  ASSERT_EQ(registry.version(), version + 2);
+  ASSERT_EQ(registry.find("B"), nullptr);
+}
+
+TEST(AllocatorRegistryTest, ConcurrentFind)
+{
+  AllocatorRegistry registry;
+  const int num_names{256};
+
+  registry.update([](AllocatorRegistry::Snapshot& snapshot) { snapshot.names["STABLE"] = strategy(0x10); });
+
+  std::atomic<bool> done{false};
+  std::atomic<int> errors{0};
+  std::vector<std::thread> readers;
+
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&]() {
+      while (!done.load()) {
+        if (registry.find("STABLE") != strategy(0x10)) {
+          ++errors;
+        }
+
+        // Names are only ever added with their final strategy
+        for (int i = 0; i < num_names; i += 17) {
+          AllocationStrategy* found{registry.find(i)};
+          if (found && found != strategy(0x100 + i)) {
+            ++errors;
+          }
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < num_names; ++i) {
+    registry.update([i](AllocatorRegistry::Snapshot& snapshot) {
+      snapshot.names["ALLOCATOR_" + std::to_string(i)] = strategy(0x100 + i);
+      snapshot.ids[i] = strategy(0x100 + i);
+    });
+  }
+
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  ASSERT_EQ(errors.load(), 0);
+  for (int i = 0; i < num_names; ++i) {
+    ASSERT_EQ(registry.find("ALLOCATOR_" + std::to_string(i)), strategy(0x100 + i));
+  }
+}
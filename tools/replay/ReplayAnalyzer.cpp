@@ -0,0 +1,641 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#include "ReplayAnalyzer.hpp"
+#include "ReplayMacros.hpp"
+#include "umpire/strategy/DynamicPoolList.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+#include <unistd.h> // getpid()
+
+namespace {
+
+// Defaults of the MixedPool constructor
+const std::size_t mixed_smallest_fixed_obj_size{1 << 8};
+const std::size_t mixed_largest_fixed_obj_size{1 << 17};
+const std::size_t mixed_max_initial_fixed_pool_size{1024 * 1024 * 2};
+const std::size_t mixed_fixed_size_multiplier{16};
+
+// Recommended block sizes are rounded up to this
+const std::size_t block_granularity{1024 * 1024};
+
+// Number of points in each live bytes curve
+const std::size_t curve_points{1024};
+
+// Reuse distances are only counted up to this many distinct sizes
+const std::size_t max_reuse_distance{4096};
+
+const std::size_t max_recommended_fixed_pools{8};
+
+int bin(std::size_t value)
+{
+  int index{0};
+  while (value > 1) {
+    value >>= 1;
+    ++index;
+  }
+  return index;
+}
+
+std::size_t round_up(std::size_t value, std::size_t multiple)
+{
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+std::size_t round_up_pow2(std::size_t value)
+{
+  std::size_t result{1};
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+const char* type_name(ReplayFile::rtype type)
+{
+  switch (type) {
+    case ReplayFile::MEMORY_RESOURCE:
+      return "MemoryResource";
+    case ReplayFile::ALLOCATION_ADVISOR:
+      return "AllocationAdvisor";
+    case ReplayFile::DYNAMIC_POOL_LIST:
+      return "DynamicPoolList";
+    case ReplayFile::MONOTONIC:
+      return "MonotonicAllocationStrategy";
+    case ReplayFile::SLOT_POOL:
+      return "SlotPool";
+    case ReplayFile::SIZE_LIMITER:
+      return "SizeLimiter";
+    case ReplayFile::THREADSAFE_ALLOCATOR:
+      return "ThreadSafeAllocator";
+    case ReplayFile::FIXED_POOL:
+      return "FixedPool";
+    case ReplayFile::MIXED_POOL:
+      return "MixedPool";
+    case ReplayFile::ALLOCATION_PREFETCHER:
+      return "AllocationPrefetcher";
+    case ReplayFile::NUMA_POLICY:
+      return "NumaPolicy";
+    case ReplayFile::QUICKPOOL:
+      return "QuickPool";
+    default:
+      return "Unknown";
+  }
+}
+
+void print_bin_range(std::ostream& os, int index)
+{
+  os << "[2^" << index << " - 2^" << index + 1 << ")";
+}
+
+} // namespace
+
+void ReplayAnalyzer::PoolModel::configure(std::size_t first, std::size_t next, std::size_t align)
+{
+  first_block = first;
+  next_block = next;
+  alignment = std::max(align, std::size_t{1});
+}
+
+void ReplayAnalyzer::PoolModel::addFixedSizeClasses(std::size_t smallest, std::size_t largest,
+                                                    std::size_t max_initial_pool_size, std::size_t multiplier)
+{
+  // Same size classes as the MixedPool constructor
+  for (std::size_t object_bytes = smallest; object_bytes > 0 && object_bytes <= largest; object_bytes *= multiplier) {
+    const std::size_t objects_per_pool{std::min(64 * sizeof(int) * 8, max_initial_pool_size / object_bytes)};
+    if (objects_per_pool <= 1 || multiplier <= 1) {
+      break;
+    }
+    m_fixed.push_back(FixedSizeClass{object_bytes, objects_per_pool, 0, 0});
+  }
+}
+
+void ReplayAnalyzer::PoolModel::allocate(std::size_t id, std::size_t bytes)
+{
+  for (std::size_t index = 0; index < m_fixed.size(); ++index) {
+    FixedSizeClass& size_class{m_fixed[index]};
+    if (bytes <= size_class.object_bytes) {
+      if (++size_class.live > size_class.capacity) {
+        size_class.capacity += size_class.objects_per_pool;
+        footprint += size_class.objects_per_pool * size_class.object_bytes;
+        peak_footprint = std::max(peak_footprint, footprint);
+        blocks_allocated++;
+      }
+      m_used[id] = Block{index, size_class.object_bytes, true};
+      return;
+    }
+  }
+
+  const std::size_t size{round_up(std::max(bytes, std::size_t{1}), alignment)};
+
+  auto best = m_free_by_size.lower_bound(std::make_pair(size, std::size_t{0}));
+  if (best == m_free_by_size.end()) {
+    grow(size);
+    best = m_free_by_size.lower_bound(std::make_pair(size, std::size_t{0}));
+  }
+
+  const std::size_t address{best->second};
+  const std::size_t block_size{best->first};
+
+  eraseFree(m_free_by_address.find(address));
+  if (block_size > size) {
+    insertFree(address + size, block_size - size);
+  }
+
+  m_used[id] = Block{address, size, false};
+}
+
+void ReplayAnalyzer::PoolModel::deallocate(std::size_t id)
+{
+  auto used = m_used.find(id);
+  if (used == m_used.end()) {
+    return;
+  }
+
+  const Block& block{used->second};
+  if (block.fixed) {
+    m_fixed[block.address].live--;
+  } else {
+    insertFree(block.address, block.size);
+  }
+
+  m_used.erase(used);
+}
+
+void ReplayAnalyzer::PoolModel::release()
+{
+  for (auto chunk = m_chunks.begin(); chunk != m_chunks.end();) {
+    auto block = m_free_by_address.find(chunk->first);
+    if (block != m_free_by_address.end() && block->second == chunk->second) {
+      eraseFree(block);
+      footprint -= chunk->second;
+      chunk = m_chunks.erase(chunk);
+    } else {
+      ++chunk;
+    }
+  }
+}
+
+double ReplayAnalyzer::PoolModel::fragmentation() const noexcept
+{
+  if (m_free_bytes == 0) {
+    return 0.0;
+  }
+
+  const std::size_t largest{m_free_by_size.rbegin()->first};
+  return 1.0 - static_cast<double>(largest) / static_cast<double>(m_free_bytes);
+}
+
+void ReplayAnalyzer::PoolModel::grow(std::size_t size)
+{
+  const std::size_t minimum{blocks_allocated == 0 ? first_block : next_block};
+  const std::size_t chunk_size{round_up(std::max(size, minimum), alignment)};
+
+  const std::size_t address{m_top};
+  m_top += chunk_size;
+
+  m_chunks.emplace(address, chunk_size);
+  footprint += chunk_size;
+  peak_footprint = std::max(peak_footprint, footprint);
+  blocks_allocated++;
+
+  insertFree(address, chunk_size);
+}
+
+void ReplayAnalyzer::PoolModel::insertFree(std::size_t address, std::size_t size)
+{
+  // Blocks are only coalesced within the chunk they were carved from
+  auto next = m_free_by_address.find(address + size);
+  if (next != m_free_by_address.end() && m_chunks.find(next->first) == m_chunks.end()) {
+    size += next->second;
+    eraseFree(next);
+  }
+
+  if (m_chunks.find(address) == m_chunks.end()) {
+    auto prev = m_free_by_address.lower_bound(address);
+    if (prev != m_free_by_address.begin()) {
+      --prev;
+      if (prev->first + prev->second == address) {
+        address = prev->first;
+        size += prev->second;
+        eraseFree(prev);
+      }
+    }
+  }
+
+  m_free_by_address.emplace(address, size);
+  m_free_by_size.emplace(size, address);
+  m_free_bytes += size;
+}
+
+void ReplayAnalyzer::PoolModel::eraseFree(std::map<std::size_t, std::size_t>::iterator block)
+{
+  m_free_by_size.erase(std::make_pair(block->second, block->first));
+  m_free_bytes -= block->second;
+  m_free_by_address.erase(block);
+}
+
+ReplayAnalyzer::ReplayAnalyzer(const ReplayOptions& options, ReplayFile* rFile, ReplayFile::Header* Operations)
+    : m_options{options}, m_replay_file{rFile}, m_ops_table{Operations}
+{
+  for (std::size_t i = 0; i < m_ops_table->num_allocators; i++) {
+    const auto& alloc = m_ops_table->allocators[i];
+    if (alloc.type == ReplayFile::rtype::MEMORY_RESOURCE && std::strcmp(alloc.name, "HOST") == 0) {
+      m_default_allocator = static_cast<int>(i);
+    }
+  }
+
+  m_window = std::max(m_ops_table->num_operations / curve_points, std::size_t{1});
+}
+
+void ReplayAnalyzer::analyzeOperations()
+{
+  for (std::size_t i = 1; i < m_ops_table->num_operations; ++i) {
+    const auto op = &m_ops_table->ops[i];
+
+    switch (op->op_type) {
+      case ReplayFile::otype::ALLOCATOR_CREATION:
+        getAnalysis(op->op_allocator);
+        break;
+      case ReplayFile::otype::SETDEFAULTALLOCATOR:
+        m_default_allocator = op->op_allocator;
+        break;
+      case ReplayFile::otype::ALLOCATE:
+        recordAllocation(op->op_allocator, i, op->op_size);
+        break;
+      case ReplayFile::otype::DEALLOCATE:
+        recordDeallocation(op->op_allocator, i, op->op_alloc_ops[0]);
+        break;
+      case ReplayFile::otype::REALLOCATE:
+      case ReplayFile::otype::REALLOCATE_EX: {
+        const std::size_t previous{op->op_alloc_ops[1]};
+        int allocator{op->op_allocator};
+
+        if (op->op_type == ReplayFile::otype::REALLOCATE) {
+          allocator = (previous == 0) ? m_default_allocator : allocatorOf(previous);
+          m_reallocate_allocators[i] = allocator;
+        }
+
+        if (previous != 0) {
+          recordDeallocation(allocatorOf(previous), i, previous);
+        }
+        recordAllocation(allocator, i, op->op_size);
+        break;
+      }
+      case ReplayFile::otype::RELEASE:
+        getAnalysis(op->op_allocator).model.release();
+        break;
+      case ReplayFile::otype::COALESCE:
+      case ReplayFile::otype::COPY:
+      case ReplayFile::otype::MOVE:
+        break;
+      default:
+        REPLAY_ERROR("Unknown operation type: " << op->op_type);
+        break;
+    }
+
+    if (i % m_window == 0) {
+      closeWindow(i);
+    }
+  }
+  closeWindow(m_ops_table->num_operations);
+
+  std::cout << "Analysis of " << m_replay_file->getInputFileName() << " (" << m_ops_table->num_operations - 1
+            << " operations)" << std::endl;
+
+  for (const auto& analysis : m_analysis) {
+    if (analysis.second.allocations > 0) {
+      printAnalysis(analysis.first, analysis.second);
+      printRecommendations(analysis.second);
+    }
+  }
+
+  if (m_options.dump_statistics) {
+    dumpCurves();
+  }
+}
+
+ReplayAnalyzer::AllocatorAnalysis& ReplayAnalyzer::getAnalysis(int allocator)
+{
+  auto analysis = m_analysis.find(allocator);
+  if (analysis == m_analysis.end()) {
+    analysis = m_analysis.emplace(allocator, AllocatorAnalysis{}).first;
+    configureModel(allocator, analysis->second.model);
+  }
+  return analysis->second;
+}
+
+void ReplayAnalyzer::configureModel(int allocator, PoolModel& model)
+{
+  const auto& alloc = m_ops_table->allocators[allocator];
+
+  switch (alloc.type) {
+    case ReplayFile::rtype::QUICKPOOL:
+    case ReplayFile::rtype::DYNAMIC_POOL_LIST:
+      model.configure(
+          alloc.argc >= 2 ? alloc.argv.pool.initial_alloc_size
+                          : umpire::strategy::QuickPool::s_default_first_block_size,
+          alloc.argc >= 3 ? alloc.argv.pool.min_alloc_size : umpire::strategy::QuickPool::s_default_next_block_size,
+          alloc.argc >= 4 ? static_cast<std::size_t>(alloc.argv.pool.alignment)
+                          : umpire::strategy::QuickPool::s_default_alignment);
+      break;
+
+    case ReplayFile::rtype::MIXED_POOL: {
+      const auto& args = alloc.argv.mixed_pool;
+      model.configure(
+          alloc.argc >= 6 ? args.dynamic_initial_alloc_bytes : umpire::strategy::QuickPool::s_default_first_block_size,
+          alloc.argc >= 7 ? args.dynamic_min_alloc_bytes : umpire::strategy::QuickPool::s_default_next_block_size,
+          alloc.argc >= 8 ? args.dynamic_align_bytes : umpire::strategy::QuickPool::s_default_alignment);
+      model.addFixedSizeClasses(alloc.argc >= 2 ? args.smallest_fixed_blocksize : mixed_smallest_fixed_obj_size,
+                                alloc.argc >= 3 ? args.largest_fixed_blocksize : mixed_largest_fixed_obj_size,
+                                alloc.argc >= 4 ? args.max_fixed_blocksize : mixed_max_initial_fixed_pool_size,
+                                alloc.argc >= 5 ? args.size_multiplier : mixed_fixed_size_multiplier);
+      break;
+    }
+
+    default:
+      // Show what a QuickPool with the default parameters would do
+      model.configure(umpire::strategy::QuickPool::s_default_first_block_size,
+                      umpire::strategy::QuickPool::s_default_next_block_size,
+                      umpire::strategy::QuickPool::s_default_alignment);
+      break;
+  }
+}
+
+void ReplayAnalyzer::recordAllocation(int allocator, std::size_t op_index, std::size_t bytes)
+{
+  if (allocator < 0) {
+    return;
+  }
+
+  AllocatorAnalysis& analysis{getAnalysis(allocator)};
+
+  analysis.allocations++;
+  analysis.live_bytes += bytes;
+  analysis.largest_allocation = std::max(analysis.largest_allocation, bytes);
+  analysis.window_peak = std::max(analysis.window_peak, analysis.live_bytes);
+
+  SizeClass& size_class{analysis.size_classes[bin(bytes)]};
+  size_class.allocations++;
+  size_class.bytes += bytes;
+  size_class.live++;
+  size_class.peak_live = std::max(size_class.peak_live, size_class.live);
+
+  SizeCount& size_count{analysis.sizes[bytes]};
+  size_count.allocations++;
+  size_count.live++;
+  size_count.peak_live = std::max(size_count.peak_live, size_count.live);
+
+  recordReuseDistance(analysis, bytes);
+
+  analysis.model.allocate(op_index, bytes);
+
+  if (analysis.live_bytes > analysis.peak_live_bytes) {
+    analysis.peak_live_bytes = analysis.live_bytes;
+    analysis.peak_operation = op_index;
+    analysis.fragmentation_at_peak = analysis.model.fragmentation();
+  }
+}
+
+void ReplayAnalyzer::recordDeallocation(int allocator, std::size_t op_index, std::size_t alloc_op_index)
+{
+  m_reallocate_allocators.erase(alloc_op_index);
+
+  if (allocator < 0) {
+    return;
+  }
+
+  AllocatorAnalysis& analysis{getAnalysis(allocator)};
+  const std::size_t bytes{m_ops_table->ops[alloc_op_index].op_size};
+
+  analysis.deallocations++;
+  analysis.live_bytes -= std::min(bytes, analysis.live_bytes);
+
+  SizeClass& size_class{analysis.size_classes[bin(bytes)]};
+  const std::size_t lifetime{op_index - alloc_op_index};
+  size_class.live--;
+  size_class.deallocations++;
+  size_class.total_lifetime += lifetime;
+  size_class.lifetimes[bin(lifetime)]++;
+
+  analysis.sizes[bytes].live--;
+
+  analysis.model.deallocate(alloc_op_index);
+}
+
+void ReplayAnalyzer::recordReuseDistance(AllocatorAnalysis& analysis, std::size_t bytes)
+{
+  auto position = analysis.recent_size_positions.find(bytes);
+
+  if (position == analysis.recent_size_positions.end()) {
+    analysis.first_uses++;
+    analysis.recent_sizes.push_front(bytes);
+    analysis.recent_size_positions[bytes] = analysis.recent_sizes.begin();
+    return;
+  }
+
+  // The number of distinct sizes allocated since this size was last allocated
+  std::size_t distance{0};
+  for (auto iter = analysis.recent_sizes.begin(); iter != position->second && distance < max_reuse_distance;
+       ++iter) {
+    ++distance;
+  }
+
+  analysis.reuse_distances[distance == 0 ? 0 : bin(distance) + 1]++;
+  analysis.recent_sizes.splice(analysis.recent_sizes.begin(), analysis.recent_sizes, position->second);
+}
+
+void ReplayAnalyzer::closeWindow(std::size_t op_index)
+{
+  for (auto& analysis : m_analysis) {
+    analysis.second.live_bytes_curve.push_back(std::make_pair(op_index, analysis.second.window_peak));
+    analysis.second.window_peak = analysis.second.live_bytes;
+  }
+}
+
+int ReplayAnalyzer::allocatorOf(std::size_t alloc_op_index) const
+{
+  const auto& op = m_ops_table->ops[alloc_op_index];
+
+  if (op.op_type == ReplayFile::otype::REALLOCATE) {
+    auto allocator = m_reallocate_allocators.find(alloc_op_index);
+    return (allocator == m_reallocate_allocators.end()) ? -1 : allocator->second;
+  }
+
+  return op.op_allocator;
+}
+
+void ReplayAnalyzer::printAnalysis(int allocator, const AllocatorAnalysis& analysis) const
+{
+  const auto& alloc = m_ops_table->allocators[allocator];
+
+  std::cout << std::endl << alloc.name << " (" << type_name(alloc.type) << "):" << std::endl;
+  std::cout << "    Total Allocations:    " << analysis.allocations << std::endl;
+  std::cout << "    Total Deallocations:  " << analysis.deallocations << std::endl;
+  std::cout << "    Largest Allocation:   " << analysis.largest_allocation << std::endl;
+  std::cout << "    Peak Live Bytes:      " << analysis.peak_live_bytes << " (operation " << analysis.peak_operation
+            << ", line " << m_ops_table->ops[analysis.peak_operation].op_line_number << ")" << std::endl;
+
+  std::cout << "    Size Classes (allocations, high watermark of allocations, mean lifetime in operations):"
+            << std::endl;
+  for (const auto& entry : analysis.size_classes) {
+    const SizeClass& size_class{entry.second};
+
+    std::cout << "    ";
+    print_bin_range(std::cout, entry.first);
+    std::cout << " = " << size_class.allocations << ", " << size_class.peak_live << ", ";
+    if (size_class.deallocations > 0) {
+      std::cout << size_class.total_lifetime / size_class.deallocations;
+    } else {
+      std::cout << "-";
+    }
+    std::cout << std::endl;
+
+    if (size_class.deallocations > 0) {
+      std::cout << "        Lifetimes:";
+      const char* separator{" "};
+      for (int i = 0; i < num_bins; i++) {
+        if (size_class.lifetimes[i]) {
+          std::cout << separator;
+          print_bin_range(std::cout, i);
+          std::cout << " = " << size_class.lifetimes[i];
+          separator = ", ";
+        }
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  std::cout << "    Size Reuse Distances (distinct sizes allocated in between):" << std::endl;
+  std::cout << "    First Use = " << analysis.first_uses << std::endl;
+  for (int i = 0; i < num_bins; i++) {
+    if (analysis.reuse_distances[i]) {
+      if (i == 0) {
+        std::cout << "    0 = ";
+      } else {
+        std::cout << "    ";
+        print_bin_range(std::cout, i - 1);
+        std::cout << " = ";
+      }
+      std::cout << analysis.reuse_distances[i] << std::endl;
+    }
+  }
+
+  const PoolModel& model{analysis.model};
+  const std::size_t overhead{model.peak_footprint - std::min(model.peak_footprint, analysis.peak_live_bytes)};
+
+  std::cout << "    Modeled Pool (first block " << model.first_block << ", next block " << model.next_block
+            << ", alignment " << model.alignment << "):" << std::endl;
+  std::cout << "        Peak Pool Size:           " << model.peak_footprint << std::endl;
+  std::cout << "        Overhead Over Peak Live:  " << overhead << " (" << std::fixed << std::setprecision(1)
+            << (model.peak_footprint ? 100.0 * overhead / model.peak_footprint : 0.0) << "%)" << std::endl;
+  std::cout << "        Fragmentation At Peak:    " << std::setprecision(3) << analysis.fragmentation_at_peak
+            << std::endl;
+  std::cout << "        Blocks Allocated:         " << model.blocks_allocated << std::endl;
+  std::cout << std::defaultfloat;
+}
+
+void ReplayAnalyzer::printRecommendations(const AllocatorAnalysis& analysis) const
+{
+  //
+  // The first block holds the peak live bytes, so that only fragmentation
+  // grows the pool, and every next block fits the largest allocation.
+  //
+  const std::size_t first_block{round_up(std::max(analysis.peak_live_bytes, std::size_t{1}), block_granularity)};
+  const std::size_t next_block{
+      round_up(std::max(analysis.largest_allocation, umpire::strategy::QuickPool::s_default_next_block_size),
+               block_granularity)};
+
+  std::cout << "    Recommended QuickPool/DynamicPoolList Parameters:" << std::endl;
+  std::cout << "        first_minimum_pool_allocation_size = " << first_block << std::endl;
+  std::cout << "        next_minimum_pool_allocation_size = " << next_block << std::endl;
+
+  //
+  // Frequently allocated small sizes are worth a FixedPool each, with room
+  // for as many objects as were live at once.
+  //
+  std::vector<std::pair<std::size_t, SizeCount>> fixed_sizes;
+  for (const auto& size : analysis.sizes) {
+    if (size.first > 0 && size.first <= mixed_largest_fixed_obj_size &&
+        size.second.allocations * 100 >= analysis.allocations) {
+      fixed_sizes.push_back(size);
+    }
+  }
+
+  std::sort(fixed_sizes.begin(), fixed_sizes.end(),
+            [](const std::pair<std::size_t, SizeCount>& a, const std::pair<std::size_t, SizeCount>& b) {
+              return a.second.allocations > b.second.allocations;
+            });
+  if (fixed_sizes.size() > max_recommended_fixed_pools) {
+    fixed_sizes.resize(max_recommended_fixed_pools);
+  }
+  std::sort(fixed_sizes.begin(), fixed_sizes.end(),
+            [](const std::pair<std::size_t, SizeCount>& a, const std::pair<std::size_t, SizeCount>& b) {
+              return a.first < b.first;
+            });
+
+  if (fixed_sizes.empty()) {
+    std::cout << "    Recommended FixedPool Sizes: none, no small size makes up 1% of the allocations" << std::endl;
+    return;
+  }
+
+  std::cout << "    Recommended FixedPool Sizes (object_bytes, objects_per_pool):" << std::endl;
+  for (const auto& size : fixed_sizes) {
+    std::cout << "        " << size.first << ", " << std::max(round_up_pow2(size.second.peak_live), std::size_t{64})
+              << std::endl;
+  }
+
+  //
+  // MixedPool size classes grow by a constant multiplier, so pick the
+  // smallest power of two that covers the fixed sizes in a few classes.
+  //
+  const std::size_t smallest{round_up_pow2(std::max(fixed_sizes.front().first, std::size_t{16}))};
+  const std::size_t largest{round_up_pow2(std::max(fixed_sizes.back().first, std::size_t{16}))};
+  std::size_t multiplier{2};
+  while (static_cast<std::size_t>(bin(largest / smallest) / bin(multiplier)) + 1 > max_recommended_fixed_pools) {
+    multiplier *= 2;
+  }
+
+  std::cout << "    Recommended MixedPool Parameters:" << std::endl;
+  std::cout << "        smallest_fixed_obj_size = " << smallest << std::endl;
+  std::cout << "        largest_fixed_obj_size = " << largest << std::endl;
+  std::cout << "        fixed_size_multiplier = " << multiplier << std::endl;
+  std::cout << "        quick_pool_initial_alloc_size = " << first_block << std::endl;
+  std::cout << "        quick_pool_min_alloc_size = " << next_block << std::endl;
+}
+
+void ReplayAnalyzer::dumpCurves() const
+{
+  std::ofstream file;
+  const int pid{getpid()};
+
+  const std::string filename{"replay_analysis" + std::to_string(pid) + ".ult"};
+  file.open(filename);
+
+  for (const auto& analysis : m_analysis) {
+    if (analysis.second.allocations == 0) {
+      continue;
+    }
+
+    file << "# " << m_ops_table->allocators[analysis.first].name << " live bytes" << std::endl;
+    for (const auto& entry : analysis.second.live_bytes_curve) {
+      file << entry.first << " " << entry.second << std::endl;
+    }
+  }
+
+  std::cout << std::endl << "Live bytes curves written to " << filename << std::endl;
+}
+
+#endif // !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
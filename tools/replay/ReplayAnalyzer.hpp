@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef REPLAY_ReplayAnalyzer_HPP
+#define REPLAY_ReplayAnalyzer_HPP
+
+#if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ReplayFile.hpp"
+#include "ReplayOptions.hpp"
+
+//
+// Computes allocation statistics from a compiled replay in a single pass
+// over its operations, without creating any allocators or touching any
+// memory, and recommends pool parameters from them.
+//
+class ReplayAnalyzer {
+ public:
+  ReplayAnalyzer(const ReplayOptions& options, ReplayFile* rFile, ReplayFile::Header* Operations);
+
+  void analyzeOperations();
+
+ private:
+  static const int num_bins{64};
+  using Histogram = std::array<std::size_t, num_bins>;
+
+  //
+  // Address-only model of a pool: best-fit placement with coalescing of
+  // neighboring free blocks, growing by the pool's block sizes. For
+  // MixedPool parameters, small sizes are rounded up to the fixed pool size
+  // classes, which grow by whole pools of objects.
+  //
+  class PoolModel {
+   public:
+    void configure(std::size_t first_block, std::size_t next_block, std::size_t alignment);
+    void addFixedSizeClasses(std::size_t smallest, std::size_t largest, std::size_t max_initial_pool_size,
+                             std::size_t multiplier);
+
+    void allocate(std::size_t id, std::size_t bytes);
+    void deallocate(std::size_t id);
+    void release();
+
+    // 1 - largest free block / free bytes, over the free blocks of the pool
+    double fragmentation() const noexcept;
+
+    std::size_t first_block{0};
+    std::size_t next_block{0};
+    std::size_t alignment{16};
+
+    std::size_t footprint{0};
+    std::size_t peak_footprint{0};
+    std::size_t blocks_allocated{0};
+
+   private:
+    struct FixedSizeClass {
+      std::size_t object_bytes;
+      std::size_t objects_per_pool;
+      std::size_t live;
+      std::size_t capacity;
+    };
+
+    struct Block {
+      std::size_t address;
+      std::size_t size;
+      bool fixed;
+    };
+
+    void grow(std::size_t size);
+    void insertFree(std::size_t address, std::size_t size);
+    void eraseFree(std::map<std::size_t, std::size_t>::iterator block);
+
+    std::vector<FixedSizeClass> m_fixed;
+    std::map<std::size_t, std::size_t> m_chunks;
+    std::map<std::size_t, std::size_t> m_free_by_address;
+    // Ordered by size, then address
+    std::set<std::pair<std::size_t, std::size_t>> m_free_by_size;
+    // Keyed by the index of the allocating operation
+    std::unordered_map<std::size_t, Block> m_used;
+    std::size_t m_free_bytes{0};
+    std::size_t m_top{0};
+  };
+
+  struct SizeClass {
+    std::size_t allocations{0};
+    std::size_t bytes{0};
+    std::size_t live{0};
+    std::size_t peak_live{0};
+    std::size_t deallocations{0};
+    std::size_t total_lifetime{0};
+    Histogram lifetimes{};
+  };
+
+  struct SizeCount {
+    std::size_t allocations{0};
+    std::size_t live{0};
+    std::size_t peak_live{0};
+  };
+
+  struct AllocatorAnalysis {
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+    std::size_t live_bytes{0};
+    std::size_t peak_live_bytes{0};
+    std::size_t peak_operation{0};
+    std::size_t largest_allocation{0};
+    double fragmentation_at_peak{0.0};
+
+    std::map<int, SizeClass> size_classes;
+    std::unordered_map<std::size_t, SizeCount> sizes;
+
+    // Most recently allocated sizes first, for the reuse distances
+    std::list<std::size_t> recent_sizes;
+    std::unordered_map<std::size_t, std::list<std::size_t>::iterator> recent_size_positions;
+    std::size_t first_uses{0};
+    Histogram reuse_distances{};
+
+    // Highest live bytes in each window of operations
+    std::vector<std::pair<std::size_t, std::size_t>> live_bytes_curve;
+    std::size_t window_peak{0};
+
+    PoolModel model;
+  };
+
+  AllocatorAnalysis& getAnalysis(int allocator);
+  void configureModel(int allocator, PoolModel& model);
+  void recordAllocation(int allocator, std::size_t op_index, std::size_t bytes);
+  void recordDeallocation(int allocator, std::size_t op_index, std::size_t alloc_op_index);
+  void recordReuseDistance(AllocatorAnalysis& analysis, std::size_t bytes);
+  void closeWindow(std::size_t op_index);
+  int allocatorOf(std::size_t alloc_op_index) const;
+
+  void printAnalysis(int allocator, const AllocatorAnalysis& analysis) const;
+  void printRecommendations(const AllocatorAnalysis& analysis) const;
+  void dumpCurves() const;
+
+  ReplayOptions m_options;
+  ReplayFile* m_replay_file;
+  ReplayFile::Header* m_ops_table;
+
+  std::map<int, AllocatorAnalysis> m_analysis;
+  // REALLOCATE operations do not name an allocator, so keep the one used
+  std::unordered_map<std::size_t, int> m_reallocate_allocators;
+  int m_default_allocator{-1};
+  std::size_t m_window{1};
+};
+
+#endif // !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#endif // REPLAY_ReplayAnalyzer_HPP
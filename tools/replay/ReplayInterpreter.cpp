@@ -14,6 +14,7 @@
 #if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
 #include <cxxabi.h> // for __cxa_demangle
 
+#include "ReplayAnalyzer.hpp"
 #include "ReplayFile.hpp"
 #include "ReplayInterpreter.hpp"
 #include "ReplayMacros.hpp"
@@ -49,6 +50,13 @@ void ReplayInterpreter::runOperations()
   m_operation_mgr.runOperations();
 }
 
+void ReplayInterpreter::analyzeOperations()
+{
+  ReplayAnalyzer analyzer{m_options, m_ops, m_ops->getOperationsTable()};
+
+  analyzer.analyzeOperations();
+}
+
 void ReplayInterpreter::buildOperations()
 {
   ReplayFile::Header* hdr{nullptr};
@@ -22,6 +22,7 @@ class ReplayInterpreter {
  public:
   void buildOperations();
   void runOperations();
+  void analyzeOperations();
   bool compareOperations(ReplayInterpreter& rh);
 
   ReplayInterpreter(const ReplayOptions& options);
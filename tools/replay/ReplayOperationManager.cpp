@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <iomanip>
@@ -16,12 +17,14 @@
 #include "ReplayOptions.hpp"
 #include "umpire/Allocator.hpp"
 #include "umpire/ResourceManager.hpp"
+#include "umpire/resource/NoOpMemoryResource.hpp"
 #include "umpire/strategy/AllocationAdvisor.hpp"
 #include "umpire/strategy/AllocationPrefetcher.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/QuickPool.hpp"
 #include "umpire/strategy/SizeLimiter.hpp"
 #include "umpire/util/AllocationRecord.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 #include "umpire/util/wrap_allocator.hpp"
 #if defined(UMPIRE_ENABLE_NUMA)
 #include "umpire/strategy/NumaPolicy.hpp"
@@ -160,6 +163,13 @@ void ReplayOperationManager::runOperations()
             size_histogram[op->op_allocator] = TrackedHistogram{};
           }
           makeAllocator(op);
+          if (m_options.simulate) {
+            auto alloc = &m_ops_table->allocators[op->op_allocator];
+            SimulationStats& stats{m_simulation_stats[alloc->allocator->getId()]};
+            if (stats.name.empty()) {
+              stats.name = alloc->name;
+            }
+          }
           break;
         case ReplayFile::otype::SETDEFAULTALLOCATOR:
           if (m_options.track_stats) {
@@ -168,21 +178,32 @@ void ReplayOperationManager::runOperations()
           makeSetDefaultAllocator(op);
           break;
         case ReplayFile::otype::COPY:
-          if (m_options.skip_operations == false) {
+          if (m_options.skip_operations == false && m_options.simulate == false) {
             makeCopy(op);
           }
           break;
         case ReplayFile::otype::REALLOCATE:
-          makeReallocate(op);
+          if (m_options.simulate) {
+            makeSimulatedReallocate(op);
+          } else {
+            makeReallocate(op);
+          }
           break;
         case ReplayFile::otype::REALLOCATE_EX:
-          makeReallocate_ex(op);
+          if (m_options.simulate) {
+            makeSimulatedReallocate(op);
+          } else {
+            makeReallocate_ex(op);
+          }
           break;
         case ReplayFile::otype::ALLOCATE:
           if (m_options.track_stats || m_options.dump_statistics) {
             size_histogram[op->op_allocator].increment(op->op_size);
           }
           makeAllocate(op);
+          if (m_options.simulate) {
+            recordSimulatedOperation(*m_ops_table->allocators[op->op_allocator].allocator, op->op_type);
+          }
           break;
         case ReplayFile::otype::DEALLOCATE:
           if (m_options.track_stats || m_options.dump_statistics) {
@@ -191,12 +212,18 @@ void ReplayOperationManager::runOperations()
             size_histogram[op->op_allocator].decrement(alloc->allocator->getSize(ptr));
           }
           makeDeallocate(op);
+          if (m_options.simulate) {
+            recordSimulatedOperation(*m_ops_table->allocators[op->op_allocator].allocator, op->op_type);
+          }
           break;
         case ReplayFile::otype::COALESCE:
           makeCoalesce(op);
           break;
         case ReplayFile::otype::RELEASE:
           makeRelease(op);
+          if (m_options.simulate) {
+            recordSimulatedOperation(*m_ops_table->allocators[op->op_allocator].allocator, op->op_type);
+          }
           break;
         default:
           REPLAY_ERROR("Unknown operation type: " << op->op_type);
@@ -264,6 +291,10 @@ void ReplayOperationManager::runOperations()
     dumpStats();
   }
 
+  if (m_options.simulate) {
+    printSimulationStats();
+  }
+
   if (m_options.track_stats) {
     for (const auto& alloc_name : rm.getAllocatorNames()) {
       auto alloc = rm.getAllocator(alloc_name);
@@ -300,10 +331,31 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
     }
   }
 
+  //
+  // Check to see if user requested different pool block sizes
+  //
+  if (alloc->type == ReplayFile::rtype::DYNAMIC_POOL_LIST || alloc->type == ReplayFile::rtype::QUICKPOOL) {
+    if (m_options.first_block_size != 0) {
+      alloc->argv.pool.initial_alloc_size = m_options.first_block_size;
+      alloc->argc = std::max(alloc->argc, 2);
+    }
+    if (m_options.next_block_size != 0) {
+      if (alloc->argc < 2) {
+        alloc->argv.pool.initial_alloc_size = umpire::strategy::QuickPool::s_default_first_block_size;
+      }
+      alloc->argv.pool.min_alloc_size = m_options.next_block_size;
+      alloc->argc = std::max(alloc->argc, 3);
+    }
+  }
+
   if (m_options.introspection_off) {
     alloc->introspection = false;
   }
 
+  if (m_options.simulate && makeSimulatedAllocator(alloc, op->op_allocator)) {
+    return;
+  }
+
   switch (alloc->type) {
     case ReplayFile::rtype::MEMORY_RESOURCE:
       alloc->allocator = new umpire::Allocator(rm.getAllocator(alloc->name));
@@ -317,22 +369,22 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
           case 3:
             if (alloc->introspection) {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, true>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   alloc->argv.advisor.device_id));
             } else {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, false>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   alloc->argv.advisor.device_id));
             }
             break;
           case 4:
             if (alloc->introspection) {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, true>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   rm.getAllocator(alloc->argv.advisor.accessing_allocator), alloc->argv.advisor.device_id));
             } else {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, false>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   rm.getAllocator(alloc->argv.advisor.accessing_allocator), alloc->argv.advisor.device_id));
             }
             break;
@@ -344,20 +396,20 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
           case 2:
             if (alloc->introspection) {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, true>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice));
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice));
             } else {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, false>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice));
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice));
             }
             break;
           case 3:
             if (alloc->introspection) {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, true>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   rm.getAllocator(alloc->argv.advisor.accessing_allocator)));
             } else {
               alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationAdvisor, false>(
-                  alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.advisor.advice,
+                  alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.advisor.advice,
                   rm.getAllocator(alloc->argv.advisor.accessing_allocator)));
             }
             break;
@@ -368,10 +420,10 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
     case ReplayFile::rtype::ALLOCATION_PREFETCHER:
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationPrefetcher, true>(
-            alloc->name, rm.getAllocator(alloc->base_name)));
+            alloc->name, getBaseAllocator(alloc->base_name)));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::AllocationPrefetcher, false>(
-            alloc->name, rm.getAllocator(alloc->base_name)));
+            alloc->name, getBaseAllocator(alloc->base_name)));
       }
       break;
 
@@ -379,10 +431,10 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
 #if defined(UMPIRE_ENABLE_NUMA)
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::NumaPolicy, true>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.numa.node));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.numa.node));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::NumaPolicy, false>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.numa.node));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.numa.node));
       }
 #else
       std::cerr << "Warning, NUMA policy operation found and skipped, consider building" << std::endl
@@ -418,46 +470,46 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
 
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
+              alloc->name, getBaseAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment));
+              alloc->name, getBaseAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment));
         }
       } else if (alloc->argc >= 4) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size, alloc->argv.pool.alignment));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size, alloc->argv.pool.alignment));
         }
       } else if (alloc->argc == 3) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size));
         }
       } else if (alloc->argc == 2) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::QuickPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
         }
       } else {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(
-              rm.makeAllocator<umpire::strategy::QuickPool, true>(alloc->name, rm.getAllocator(alloc->base_name)));
+              rm.makeAllocator<umpire::strategy::QuickPool, true>(alloc->name, getBaseAllocator(alloc->base_name)));
         } else {
           alloc->allocator = new umpire::Allocator(
-              rm.makeAllocator<umpire::strategy::QuickPool, false>(alloc->name, rm.getAllocator(alloc->base_name)));
+              rm.makeAllocator<umpire::strategy::QuickPool, false>(alloc->name, getBaseAllocator(alloc->base_name)));
         }
       }
       break;
@@ -490,46 +542,46 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
 
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
+              alloc->name, getBaseAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment));
+              alloc->name, getBaseAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment));
         }
       } else if (alloc->argc >= 4) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size, alloc->argv.pool.alignment));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size, alloc->argv.pool.alignment));
         }
       } else if (alloc->argc == 3) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size,
               alloc->argv.pool.min_alloc_size));
         }
       } else if (alloc->argc == 2) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.pool.initial_alloc_size));
         }
       } else {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, true>(
-              alloc->name, rm.getAllocator(alloc->base_name)));
+              alloc->name, getBaseAllocator(alloc->base_name)));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name)));
+              alloc->name, getBaseAllocator(alloc->base_name)));
         }
       }
       break;
@@ -537,40 +589,40 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
     case ReplayFile::rtype::MONOTONIC:
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MonotonicAllocationStrategy, true>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.monotonic_pool.capacity));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.monotonic_pool.capacity));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MonotonicAllocationStrategy, false>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.monotonic_pool.capacity));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.monotonic_pool.capacity));
       }
       break;
 
     case ReplayFile::rtype::SLOT_POOL:
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::SlotPool, true>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.slot_pool.slots));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.slot_pool.slots));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::SlotPool, false>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.slot_pool.slots));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.slot_pool.slots));
       }
       break;
 
     case ReplayFile::rtype::SIZE_LIMITER:
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::SizeLimiter, true>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.size_limiter.size_limit));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.size_limiter.size_limit));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::SizeLimiter, false>(
-            alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.size_limiter.size_limit));
+            alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.size_limiter.size_limit));
       }
       break;
 
     case ReplayFile::rtype::THREADSAFE_ALLOCATOR:
       if (alloc->introspection) {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::ThreadSafeAllocator, true>(
-            alloc->name, rm.getAllocator(alloc->base_name)));
+            alloc->name, getBaseAllocator(alloc->base_name)));
       } else {
         alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::ThreadSafeAllocator, false>(
-            alloc->name, rm.getAllocator(alloc->base_name)));
+            alloc->name, getBaseAllocator(alloc->base_name)));
       }
       break;
 
@@ -578,20 +630,20 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
       if (alloc->argc >= 3) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::FixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes,
               alloc->argv.fixed_pool.objects_per_pool));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::FixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes,
               alloc->argv.fixed_pool.objects_per_pool));
         }
       } else {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::FixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::FixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.fixed_pool.object_bytes));
         }
       }
       break;
@@ -600,13 +652,13 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
       if (alloc->argc >= 8) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes,
               alloc->argv.mixed_pool.dynamic_min_alloc_bytes, alloc->argv.mixed_pool.dynamic_align_bytes));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes,
               alloc->argv.mixed_pool.dynamic_min_alloc_bytes, alloc->argv.mixed_pool.dynamic_align_bytes));
@@ -614,13 +666,13 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
       } else if (alloc->argc >= 7) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes,
               alloc->argv.mixed_pool.dynamic_min_alloc_bytes));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes,
               alloc->argv.mixed_pool.dynamic_min_alloc_bytes));
@@ -628,62 +680,62 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
       } else if (alloc->argc >= 6) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier, alloc->argv.mixed_pool.dynamic_initial_alloc_bytes));
         }
       } else if (alloc->argc >= 5) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize,
               alloc->argv.mixed_pool.size_multiplier));
         }
       } else if (alloc->argc >= 4) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize, alloc->argv.mixed_pool.max_fixed_blocksize));
         }
       } else if (alloc->argc >= 3) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize,
               alloc->argv.mixed_pool.largest_fixed_blocksize));
         }
       } else if (alloc->argc >= 2) {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, true>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::MixedPool, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize));
+              alloc->name, getBaseAllocator(alloc->base_name), alloc->argv.mixed_pool.smallest_fixed_blocksize));
         }
       } else {
         if (alloc->introspection) {
           alloc->allocator = new umpire::Allocator(
-              rm.makeAllocator<umpire::strategy::MixedPool, true>(alloc->name, rm.getAllocator(alloc->base_name)));
+              rm.makeAllocator<umpire::strategy::MixedPool, true>(alloc->name, getBaseAllocator(alloc->base_name)));
         } else {
           alloc->allocator = new umpire::Allocator(
-              rm.makeAllocator<umpire::strategy::MixedPool, false>(alloc->name, rm.getAllocator(alloc->base_name)));
+              rm.makeAllocator<umpire::strategy::MixedPool, false>(alloc->name, getBaseAllocator(alloc->base_name)));
         }
       }
       break;
@@ -694,6 +746,159 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
   }
 }
 
+umpire::Allocator ReplayOperationManager::getBaseAllocator(const std::string& name)
+{
+  auto simulated = m_simulated_allocators.find(name);
+  if (simulated != m_simulated_allocators.end()) {
+    return simulated->second;
+  }
+
+  return umpire::ResourceManager::getInstance().getAllocator(name);
+}
+
+bool ReplayOperationManager::makeSimulatedAllocator(ReplayFile::AllocatorTableEntry* alloc, int index)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  //
+  // Memory resources are replaced by NO_OP resources that only hand out
+  // addresses, and strategies that would touch the memory are left out.
+  //
+  switch (alloc->type) {
+    case ReplayFile::rtype::MEMORY_RESOURCE:
+      alloc->allocator = new umpire::Allocator(rm.makeResource("NO_OP::replay_" + std::to_string(index)));
+      break;
+
+    case ReplayFile::rtype::ALLOCATION_ADVISOR:
+    case ReplayFile::rtype::ALLOCATION_PREFETCHER:
+    case ReplayFile::rtype::NUMA_POLICY:
+      alloc->allocator = new umpire::Allocator(getBaseAllocator(alloc->base_name));
+      break;
+
+    default:
+      return false;
+  }
+
+  m_simulated_allocators.emplace(alloc->name, *alloc->allocator);
+  return true;
+}
+
+void ReplayOperationManager::makeSimulatedReallocate(ReplayFile::Operation* op)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto ptr = (op->op_alloc_ops[1] == 0) ? nullptr : m_ops_table->ops[op->op_alloc_ops[1]].op_allocated_ptr;
+
+  umpire::Allocator allocator{rm.getDefaultAllocator()};
+  if (op->op_type == ReplayFile::otype::REALLOCATE_EX) {
+    allocator = *(m_ops_table->allocators[op->op_allocator].allocator);
+  } else if (ptr != nullptr) {
+    allocator = rm.getAllocator(ptr);
+  } else {
+    allocator = getBaseAllocator(allocator.getName());
+  }
+
+  //
+  // The memory is never touched, so move to a new allocation without
+  // copying anything.
+  //
+  op->op_allocated_ptr = allocator.allocate(op->op_size);
+  if (ptr != nullptr) {
+    rm.getAllocator(ptr).deallocate(ptr);
+  }
+
+  recordSimulatedOperation(allocator, op->op_type);
+}
+
+void ReplayOperationManager::recordSimulatedOperation(umpire::Allocator& allocator, ReplayFile::otype type)
+{
+  SimulationStats& stats{m_simulation_stats[allocator.getId()]};
+
+  switch (type) {
+    case ReplayFile::otype::ALLOCATE:
+      stats.allocations++;
+      break;
+    case ReplayFile::otype::DEALLOCATE:
+      stats.deallocations++;
+      break;
+    case ReplayFile::otype::REALLOCATE:
+    case ReplayFile::otype::REALLOCATE_EX:
+      stats.reallocations++;
+      break;
+    case ReplayFile::otype::RELEASE:
+      stats.releases++;
+      break;
+    default:
+      break;
+  }
+
+  const std::size_t actual_size{allocator.getActualSize()};
+  if (actual_size > stats.peak_actual_size) {
+    stats.peak_actual_size = actual_size;
+
+    auto strategy = allocator.getAllocationStrategy();
+    if (auto quick_pool = dynamic_cast<umpire::strategy::QuickPool*>(strategy)) {
+      stats.fragmentation_at_peak = umpire::util::relative_fragmentation(quick_pool->getFreeStatistics());
+    } else if (auto list_pool = dynamic_cast<umpire::strategy::DynamicPoolList*>(strategy)) {
+      stats.fragmentation_at_peak = umpire::util::relative_fragmentation(list_pool->getFreeStatistics());
+    } else if (auto mixed_pool = dynamic_cast<umpire::strategy::MixedPool*>(strategy)) {
+      stats.fragmentation_at_peak = umpire::util::relative_fragmentation(mixed_pool->getFreeStatistics());
+    }
+  }
+}
+
+void ReplayOperationManager::printSimulationStats()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  const int num_width{16};
+
+  std::size_t longest_name{sizeof("Allocator")};
+  for (const auto& entry : m_simulation_stats) {
+    longest_name = std::max(longest_name, entry.second.name.size());
+  }
+  const int name_width{static_cast<int>(longest_name) + 2};
+
+  std::cout << std::setw(name_width) << std::left << "Allocator" << std::setw(num_width) << std::left
+            << "Allocations" << std::setw(num_width) << std::left << "Deallocations" << std::setw(num_width)
+            << std::left << "Reallocations" << std::setw(num_width) << std::left << "Releases"
+            << std::setw(num_width) << std::left << "High Watermark" << std::setw(num_width) << std::left
+            << "Peak Actual" << std::setw(num_width) << std::left << "Fragmentation" << std::endl;
+
+  for (const auto& entry : m_simulation_stats) {
+    const SimulationStats& stats{entry.second};
+    if (stats.allocations == 0 && stats.reallocations == 0) {
+      continue;
+    }
+
+    auto allocator = rm.getAllocator(entry.first);
+
+    std::cout << std::setw(name_width) << std::left << stats.name << std::setw(num_width) << std::left
+              << stats.allocations << std::setw(num_width) << std::left << stats.deallocations
+              << std::setw(num_width) << std::left << stats.reallocations << std::setw(num_width) << std::left
+              << stats.releases << std::setw(num_width) << std::left << allocator.getHighWatermark()
+              << std::setw(num_width) << std::left << stats.peak_actual_size << std::setw(num_width) << std::left
+              << stats.fragmentation_at_peak << std::endl;
+  }
+
+  std::cout << std::endl
+            << std::setw(name_width) << std::left << "Resource" << std::setw(num_width) << std::left
+            << "Peak Bytes" << std::setw(num_width) << std::left << "Allocations" << std::setw(num_width)
+            << std::left << "Deallocations" << std::endl;
+
+  for (std::size_t i = 0; i < m_ops_table->num_allocators; i++) {
+    auto alloc = &m_ops_table->allocators[i];
+    if (alloc->type != ReplayFile::rtype::MEMORY_RESOURCE || alloc->allocator == nullptr) {
+      continue;
+    }
+
+    auto resource = dynamic_cast<umpire::resource::NoOpMemoryResource*>(alloc->allocator->getAllocationStrategy());
+    if (resource != nullptr && resource->getNumAllocations() > 0) {
+      std::cout << std::setw(name_width) << std::left << alloc->name << std::setw(num_width) << std::left
+                << resource->getHighWatermark() << std::setw(num_width) << std::left << resource->getNumAllocations()
+                << std::setw(num_width) << std::left << resource->getNumDeallocations() << std::endl;
+    }
+  }
+}
+
 void ReplayOperationManager::makeAllocate(ReplayFile::Operation* op)
 {
   auto alloc = &m_ops_table->allocators[op->op_allocator];
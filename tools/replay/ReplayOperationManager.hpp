@@ -10,6 +10,8 @@
 #if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
 #include <cstdint>
 #include <iostream>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "ReplayFile.hpp"
@@ -34,11 +36,32 @@ class ReplayOperationManager {
   void runOperations();
 
  private:
+  struct SimulationStats {
+    std::string name;
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+    std::size_t reallocations{0};
+    std::size_t releases{0};
+    std::size_t peak_actual_size{0};
+    float fragmentation_at_peak{0.0};
+  };
+
   std::map<std::string, std::vector<std::pair<size_t, std::size_t>>> m_stat_series;
   ReplayOptions m_options;
   ReplayFile* m_replay_file;
   ReplayFile::Header* m_ops_table;
 
+  // Allocators that stand in for the named ones when simulating
+  std::map<std::string, umpire::Allocator> m_simulated_allocators;
+  // Keyed by allocator id, as reallocations only know the allocator
+  std::map<int, SimulationStats> m_simulation_stats;
+
+  umpire::Allocator getBaseAllocator(const std::string& name);
+  bool makeSimulatedAllocator(ReplayFile::AllocatorTableEntry* alloc, int index);
+  void makeSimulatedReallocate(ReplayFile::Operation* op);
+  void recordSimulatedOperation(umpire::Allocator& allocator, ReplayFile::otype type);
+  void printSimulationStats();
+
   void makeAllocator(ReplayFile::Operation* op);
   void makeAllocate(ReplayFile::Operation* op);
   void makeDeallocate(ReplayFile::Operation* op);
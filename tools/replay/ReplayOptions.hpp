@@ -36,20 +36,24 @@ struct ReplayUseHeuristicValidator : public CLI::Validator {
 };
 
 struct ReplayOptions {
-  bool time_replay_run{false};    // -t,--time-run
-  bool time_replay_parse{false};  // --time-parse
-  bool info_only{false};          // --info
-  bool dump_statistics{false};    // -d, --dump
-  bool track_stats{false};        // -s, --stats
-  bool skip_operations{false};    // --skip-operations
-  bool force_compile{false};      // -r,--recompile
-  bool do_not_demangle{false};    // --no-demangle
-  bool quiet{false};              // -q,--quiet
-  bool introspection_off{false};  // --introspection-off
-  std::string input_file;         // -i,-infile input_file
-  std::string pool_to_use;        // -p,--use-pool
-  std::string heuristic_to_use{}; // --use-heuristic
-  int heuristic_parm{2};          // --heuristic-parm
+  bool time_replay_run{false};     // -t,--time-run
+  bool time_replay_parse{false};   // --time-parse
+  bool info_only{false};           // --info
+  bool analyze{false};             // -a,--analyze
+  bool simulate{false};            // --simulate
+  bool dump_statistics{false};     // -d, --dump
+  bool track_stats{false};         // -s, --stats
+  bool skip_operations{false};     // --skip-operations
+  bool force_compile{false};       // -r,--recompile
+  bool do_not_demangle{false};     // --no-demangle
+  bool quiet{false};               // -q,--quiet
+  bool introspection_off{false};   // --introspection-off
+  std::string input_file;          // -i,-infile input_file
+  std::string pool_to_use;         // -p,--use-pool
+  std::string heuristic_to_use{};  // --use-heuristic
+  int heuristic_parm{2};           // --heuristic-parm
+  std::size_t first_block_size{0}; // --first-block-size
+  std::size_t next_block_size{0};  // --next-block-size
 };
 
 #endif // REPLAY_ReplayOptions_HPP
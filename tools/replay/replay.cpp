@@ -48,6 +48,18 @@ int main(int argc, char* argv[])
 
   app.add_flag("--info-only", options.info_only, "Information about replay file, no actual replay performed");
 
+  app.add_flag("-a,--analyze", options.analyze,
+               "Analyze allocation sizes and lifetimes and recommend pool parameters, no actual replay performed");
+
+  app.add_flag("--simulate", options.simulate,
+               "Replay over address-only NO_OP resources and report pool sizes, fragmentation and operation counts");
+
+  app.add_option("--first-block-size", options.first_block_size,
+                 "Override the first block size of QuickPool and DynamicPoolList allocators");
+
+  app.add_option("--next-block-size", options.next_block_size,
+                 "Override the next block size of QuickPool and DynamicPoolList allocators");
+
   app.add_flag("--no-demangle", options.do_not_demangle, "Disable demangling of replay file");
 
   app.add_flag("--skip-operations", options.skip_operations, "Skip Umpire Operations during replays");
@@ -81,7 +93,9 @@ int main(int argc, char* argv[])
     std::cout << "Parsing replay log took " << time_span.count() << " seconds." << std::endl;
   }
 
-  if (!options.info_only) {
+  if (options.analyze && !options.info_only) {
+    replay.analyzeOperations();
+  } else if (!options.info_only) {
     t1 = std::chrono::high_resolution_clock::now();
     replay.runOperations();
 